@@ -0,0 +1,93 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <iomanip>
+#include <Benchmark.hpp>
+
+using namespace nongravitar::bench;
+
+double perEntity(const Result &result) noexcept;
+
+void Benchmark::metric(std::string name, const double value) {
+    mMetrics.emplace_back(std::move(name), value);
+}
+
+const std::vector<Result> &Benchmark::getResults() const noexcept {
+    return mResults;
+}
+
+void Benchmark::writeTable(std::ostream &stream) const {
+    stream << std::left << std::setw(32) << "benchmark" << std::right << std::setw(10) << "entities"
+           << std::setw(14) << "min (ns)" << std::setw(14) << "median (ns)" << std::setw(14) << "p90 (ns)"
+           << std::setw(14) << "p99 (ns)" << std::setw(14) << "max (ns)" << std::setw(14) << "ns/entity" << std::endl;
+
+    for (const auto &result : mResults) {
+        stream << std::left << std::setw(32) << result.name << std::right << std::setw(10) << result.entities
+               << std::setw(14) << result.minNs << std::setw(14) << result.medianNs << std::setw(14) << result.p90Ns
+               << std::setw(14) << result.p99Ns << std::setw(14) << result.maxNs
+               << std::setw(14) << std::fixed << std::setprecision(1) << perEntity(result) << std::endl;
+    }
+
+    for (const auto &[name, value] : mMetrics) {
+        stream << std::left << std::setw(32) << name << std::right << std::setw(24) << std::fixed << std::setprecision(1) << value << std::endl;
+    }
+}
+
+void Benchmark::writeJson(std::ostream &stream, const std::string &suite) const {
+    stream << "{\"suite\":\"" << suite << "\",\"results\":[";
+
+    for (auto i = 0u; i < mResults.size(); i++) {
+        const auto &result = mResults[i];
+        stream << (0u == i ? "" : ",") << "{\"name\":\"" << result.name << "\",\"entities\":" << result.entities
+               << ",\"min_ns\":" << result.minNs << ",\"median_ns\":" << result.medianNs << ",\"p90_ns\":" << result.p90Ns
+               << ",\"p99_ns\":" << result.p99Ns << ",\"max_ns\":" << result.maxNs
+               << ",\"ns_per_entity\":" << std::fixed << std::setprecision(3) << perEntity(result) << "}";
+    }
+
+    stream << "],\"metrics\":{";
+
+    for (auto i = 0u; i < mMetrics.size(); i++) {
+        stream << (0u == i ? "" : ",") << "\"" << mMetrics[i].first << "\":" << std::fixed << std::setprecision(3) << mMetrics[i].second;
+    }
+
+    stream << "}}" << std::endl;
+}
+
+Result &Benchmark::record(std::string name, const std::size_t entities, std::vector<std::uint64_t> durations) {
+    const auto percentile = [&durations](const std::size_t p) { return durations[(durations.size() - 1u) * p / 100u]; };
+
+    if (durations.empty()) {
+        durations.push_back(0u);
+    }
+
+    std::sort(durations.begin(), durations.end());
+    return mResults.emplace_back(Result{std::move(name), entities, durations.front(), percentile(50u), percentile(90u), percentile(99u), durations.back()});
+}
+
+double perEntity(const Result &result) noexcept {
+    return static_cast<double>(result.medianNs) / static_cast<double>(std::max(result.entities, std::size_t{1u}));
+}
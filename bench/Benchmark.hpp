@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <ostream>
+#include <algorithm>
+
+namespace nongravitar::bench {
+    struct Result final {
+        std::string name;
+        std::size_t entities{0u};
+        std::uint64_t minNs{0u};
+        std::uint64_t medianNs{0u};
+        std::uint64_t p90Ns{0u};
+        std::uint64_t p99Ns{0u};
+        std::uint64_t maxNs{0u};
+    };
+
+    /**
+     * Times pieces of code over a number of samples, every sample starts from a state prepared by an untimed setup.
+     */
+    class Benchmark final {
+    public:
+        Benchmark() = default; // default-constructible
+
+        Benchmark(const Benchmark &) = delete; // no copy-constructible
+        Benchmark &operator=(const Benchmark &) = delete; // no copy-assignable
+
+        Benchmark(Benchmark &&) = delete; // no move-constructible
+        Benchmark &operator=(Benchmark &&) = delete; // no move-assignable
+
+        /**
+         * Run `setup` and then time `run` for each sample; `entities` is the amount of work done by a single run.
+         */
+        template<typename Setup, typename Run>
+        Result &measure(std::string name, const std::size_t entities, const unsigned samples, Setup &&setup, Run &&run) {
+            using Clock = std::chrono::steady_clock;
+            auto durations = std::vector<std::uint64_t>();
+
+            for (auto i = 0u; i < std::max(samples, 1u); i++) {
+                setup();
+                const auto started = Clock::now();
+                run();
+                durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count());
+            }
+
+            return record(std::move(name), entities, std::move(durations));
+        }
+
+        /**
+         * Add the durations of samples that were timed elsewhere, for code that can't be run in isolation.
+         */
+        Result &record(std::string name, std::size_t entities, std::vector<std::uint64_t> durations);
+
+        /**
+         * Add a value which is not a duration, e.g. a memory usage.
+         */
+        void metric(std::string name, double value);
+
+        [[nodiscard]] const std::vector<Result> &getResults() const noexcept;
+
+        void writeTable(std::ostream &stream) const;
+
+        /**
+         * Machine-readable results, so that they can be tracked over time.
+         */
+        void writeJson(std::ostream &stream, const std::string &suite) const;
+
+    private:
+        std::vector<Result> mResults;
+        std::vector<std::pair<std::string, double>> mMetrics;
+    };
+}
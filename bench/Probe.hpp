@@ -0,0 +1,117 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <Game.hpp>
+#include <scene/SolarSystem.hpp>
+#include <scene/PlanetAssault.hpp>
+
+namespace nongravitar::bench {
+    /**
+     * Opens the scenes up to the benchmarks, so that their systems can be timed one at a time.
+     */
+    class Probe final {
+    public:
+        Probe() = delete; // no default-constructible
+
+        static inline void step(Game &game, const Input &input, const sf::Time elapsed) {
+            game.step(input, elapsed);
+            game.mFrameArena.reset();
+        }
+
+        /**
+         * Render the current scene into the back buffer without publishing it, a headless game has nowhere to show it.
+         */
+        static inline void render(Game &game) noexcept {
+            if (nullSceneId != game.mCurrentSceneId) {
+                game.mSceneManager.get(game.mCurrentSceneId).render(game.mRenderer.getBackBuffer());
+            }
+        }
+
+        [[nodiscard]] static inline SceneManager &getSceneManager(Game &game) noexcept {
+            return game.mSceneManager;
+        }
+
+        [[nodiscard]] static inline SceneId getCurrentSceneId(const Game &game) noexcept {
+            return game.mCurrentSceneId;
+        }
+
+        [[nodiscard]] static inline SceneId getSolarSystemSceneId(const Game &game) noexcept {
+            return game.mSolarSystemSceneId;
+        }
+
+        [[nodiscard]] static inline entt::registry &getRegistry(scene::SolarSystem &scene) noexcept {
+            return scene.mRegistry;
+        }
+
+        [[nodiscard]] static inline entt::registry &getRegistry(scene::PlanetAssault &scene) noexcept {
+            return scene.mRegistry;
+        }
+
+        [[nodiscard]] static inline TimerQueue &getReloads(scene::PlanetAssault &scene) noexcept {
+            return scene.mReloads;
+        }
+
+        static inline void shoot(entt::registry &registry, Assets &assets, const sf::Vector2f &position, const float rotation) noexcept {
+            scene::PlanetAssault::shoot(registry, assets, position, rotation);
+        }
+
+        static inline void initializeGroups(scene::PlanetAssault &scene) noexcept {
+            scene.initializeGroups();
+        }
+
+        static inline void initializeTerrain(scene::PlanetAssault &scene, const sf::FloatRect &viewport, Assets &assets, const sf::Color color) noexcept {
+            scene.initializeTerrain(viewport, scene.generateLayout(viewport, assets), assets, color);
+        }
+
+        static inline void motionSystem(scene::PlanetAssault &scene, const sf::Time elapsed) noexcept {
+            scene.motionSystem(elapsed);
+        }
+
+        static inline void collisionSystem(scene::PlanetAssault &scene, const sf::FloatRect &viewport, Assets &assets, const sf::Time elapsed) noexcept {
+            scene.collisionSystem(viewport, assets, elapsed);
+        }
+
+        static inline void reloadSystem(scene::PlanetAssault &scene, const sf::Time elapsed) noexcept {
+            scene.reloadSystem(elapsed);
+        }
+
+        static inline void AISystem(scene::PlanetAssault &scene) noexcept {
+            scene.AISystem();
+        }
+
+        static inline void livenessSystem(scene::PlanetAssault &scene, Assets &assets, FrameArena &frameArena) noexcept {
+            scene.livenessSystem(assets, frameArena);
+        }
+
+        static inline void commandSystem(scene::PlanetAssault &scene, const sf::FloatRect &viewport, Assets &assets) noexcept {
+            scene.commandSystem(viewport, assets);
+        }
+    };
+}
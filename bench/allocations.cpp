@@ -0,0 +1,111 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <iostream>
+#include <tags.hpp>
+#include <Input.hpp>
+#include <Probe.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+#include <allocations.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+// long enough for the pools to reach their steady-state capacity and for every bunker to have shot
+constexpr auto WARM_UP_TICKS = 10u * FPS;
+
+bool suites::allocations(Benchmark &benchmark, const Settings &settings) {
+    if constexpr (not allocations::isTracking()) {
+        std::cerr << "Allocations are not tracked, build with -DNONGRAVITAR_TRACK_ALLOCATIONS=ON" << std::endl;
+        return false;
+    }
+
+    const auto &viewport = fixtures::VIEWPORT;
+    const auto elapsed = fixtures::TICK;
+    const auto input = Input();
+    auto assets = Assets();
+    auto sceneManager = SceneManager();
+    auto frameArena = FrameArena(FRAME_ARENA_CAPACITY);
+    auto workerPool = WorkerPool(0u);
+
+    assets.initialize(true);
+    auto &planet = fixtures::emplacePlanet(sceneManager, viewport, assets);
+    auto &registry = Probe::getRegistry(planet);
+
+    // steady state means the same planet forever: the player never dies
+    const auto tick = [&]() {
+        fixtures::keepPlayerAlive(registry);
+
+        planet.update(viewport, sceneManager, assets, frameArena, workerPool, input, elapsed);
+        frameArena.reset();
+    };
+
+    for (auto i = 0u; i < WARM_UP_TICKS; i++) {
+        tick();
+    }
+
+    allocations::resetScopes();
+    auto allocatingTicks = 0u;
+    auto maxAllocations = std::uint64_t{0u}, totalAllocations = std::uint64_t{0u}, totalBytes = std::uint64_t{0u};
+
+    benchmark.measure("steady-state tick", registry.alive(), settings.ticks, []() {}, [&]() {
+        const auto before = allocations::getCounters();
+        tick();
+        const auto after = allocations::getCounters();
+        const auto tickAllocations = after.allocations - before.allocations;
+
+        allocatingTicks += 0u == tickAllocations ? 0u : 1u;
+        maxAllocations = std::max(maxAllocations, tickAllocations);
+        totalAllocations += tickAllocations;
+        totalBytes += after.bytes - before.bytes;
+    });
+
+    benchmark.metric("allocating_ticks", allocatingTicks);
+    benchmark.metric("allocations_per_tick/max", maxAllocations);
+    benchmark.metric("allocations_per_tick/mean", static_cast<double>(totalAllocations) / std::max(settings.ticks, 1u));
+    benchmark.metric("bytes_per_tick/mean", static_cast<double>(totalBytes) / std::max(settings.ticks, 1u));
+
+    for (const auto &scope : allocations::getScopes()) {
+        if (nullptr != scope.name and 0u != scope.counters.allocations) {
+            benchmark.metric(std::string(scope.name) + "/allocations", scope.counters.allocations);
+            benchmark.metric(std::string(scope.name) + "/bytes", scope.counters.bytes);
+        }
+    }
+
+    if (0u != allocatingTicks) {
+        std::clog << allocatingTicks << " of " << settings.ticks << " steady-state ticks allocated" << std::endl;
+    }
+
+    return 0u == allocatingTicks;
+}
@@ -0,0 +1,159 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <tags.hpp>
+#include <Probe.hpp>
+#include <messages.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+#include <fixtures.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::assets;
+using namespace nongravitar::messages;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+sf::Vector2f randomPosition(const sf::FloatRect &area, helpers::RandomEngine &randomEngine);
+
+sf::Color fixtures::terrainColor() noexcept {
+    return sf::Color(105, 235, 245);
+}
+
+PlanetAssault &fixtures::emplacePlanet(SceneManager &sceneManager, const sf::FloatRect &viewport, Assets &assets) {
+    auto &planet = sceneManager
+            .emplace<PlanetAssault>(nullSceneId, nullSceneId, SEED)
+            .initialize(viewport, assets, terrainColor());
+
+    // the player lands as it does in game, coming from a solar system registry
+    auto solarSystem = entt::registry();
+    const auto playerId = solarSystem.create();
+    const auto &playerFrame = assets.getSpriteSheetsManager().get(SpriteSheetId::SpaceShip).getBuffer().at(0);
+
+    solarSystem.assign<Player>(playerId);
+    solarSystem.assign<Score>(playerId);
+    solarSystem.assign<Damage>(playerId, 1);
+    solarSystem.assign<Health>(playerId, PLAYER_HEALTH);
+    solarSystem.assign<Energy>(playerId, PLAYER_ENERGY);
+    solarSystem.assign<Velocity>(playerId);
+    solarSystem.assign<ReloadTime>(playerId, PLAYER_RELOAD_TIME);
+    solarSystem.assign<HitRadius>(playerId, std::max(playerFrame.width, playerFrame.height) / 2.0f);
+    solarSystem.assign<Renderable>(playerId, Renderable::sprite(SpriteSheetId::SpaceShip, 0));
+
+    pubsub::publish<PlanetEntered>(viewport, assets, solarSystem, planet.getSceneId());
+    return planet;
+}
+
+void fixtures::keepPlayerAlive(entt::registry &registry) {
+    for (const auto playerId : registry.view<Player>()) {
+        registry.replace<Health>(playerId, PLAYER_HEALTH);
+        registry.replace<Energy>(playerId, PLAYER_ENERGY);
+    }
+}
+
+bool fixtures::moveOntoPlanet(Game &game) {
+    auto &sceneManager = Probe::getSceneManager(game);
+    const auto solarSystemSceneId = Probe::getSolarSystemSceneId(game);
+
+    if (solarSystemSceneId != Probe::getCurrentSceneId(game)) {
+        return false;
+    }
+
+    auto &registry = Probe::getRegistry(dynamic_cast<SolarSystem &>(sceneManager.get(solarSystemSceneId)));
+    const auto planets = registry.view<Planet, Renderable>();
+
+    if (planets.begin() == planets.end()) {
+        return false;
+    }
+
+    const auto planetPosition = planets.get<Renderable>(*planets.begin()).getPosition();
+    registry.view<Player, Renderable>().each([&](const auto, auto &renderable) { renderable.setPosition(planetPosition); });
+    return true;
+}
+
+bool fixtures::moveOffPlanet(Game &game) {
+    const auto currentSceneId = Probe::getCurrentSceneId(game);
+    const auto planet = nullSceneId == currentSceneId ? nullptr : dynamic_cast<PlanetAssault *>(&Probe::getSceneManager(game).get(currentSceneId));
+
+    if (not planet) {
+        return false;
+    }
+
+    Probe::getRegistry(*planet).view<Player, Renderable>().each([](const auto, auto &renderable) { renderable.setPosition(-64.0f, -64.0f); });
+    return true;
+}
+
+void fixtures::addBullets(PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                          helpers::RandomEngine &randomEngine, const std::size_t count) {
+    auto &registry = Probe::getRegistry(planet);
+    const auto area = sf::FloatRect(viewport.left, viewport.top, viewport.width, viewport.height / 2.0f);
+    auto rotationDistribution = helpers::FloatDistribution(0.0f, 360.0f);
+
+    for (auto i = 0u; i < count; i++) {
+        const auto position = randomPosition(area, randomEngine);
+        Probe::shoot(registry, assets, position, rotationDistribution(randomEngine));
+    }
+}
+
+void fixtures::addBunkers(PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                          helpers::RandomEngine &randomEngine, const std::size_t count, const float reloadTime) {
+    auto &registry = Probe::getRegistry(planet);
+    const auto area = sf::FloatRect(viewport.left, viewport.top + viewport.height / 2.0f, viewport.width, viewport.height / 2.0f);
+
+    for (auto i = 0u; i < count; i++) {
+        const auto prefabId = 0u == i % 2u ? PrefabId::AI1Bunker : PrefabId::AI2Bunker;
+        const auto bunkerId = assets.getPrefabsManager().instantiate(registry, prefabId, Transform{randomPosition(area, randomEngine), 0.0f});
+
+        registry.get<ReloadTime>(bunkerId) = ReloadTime(reloadTime, reloadTime);
+        Probe::getReloads(planet).schedule(bunkerId, sf::Time::Zero);
+    }
+}
+
+void fixtures::addSupplies(PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                           helpers::RandomEngine &randomEngine, const std::size_t count) {
+    auto &registry = Probe::getRegistry(planet);
+    const auto area = sf::FloatRect(viewport.left, viewport.top + viewport.height / 2.0f, viewport.width, viewport.height / 2.0f);
+
+    for (auto i = 0u; i < count; i++) {
+        const auto prefabId = 0u == i % 2u ? PrefabId::EnergySupply : PrefabId::HealthSupply;
+        const auto supplyId = assets.getPrefabsManager().instantiate(registry, prefabId, Transform{randomPosition(area, randomEngine), 0.0f});
+
+        if (PrefabId::EnergySupply == prefabId) {
+            registry.get<Supply<Energy>>(supplyId) = Supply<Energy>(3000.0f);
+        }
+    }
+}
+
+sf::Vector2f randomPosition(const sf::FloatRect &area, helpers::RandomEngine &randomEngine) {
+    auto xDistribution = helpers::FloatDistribution(area.left, area.left + area.width);
+    auto yDistribution = helpers::FloatDistribution(area.top, area.top + area.height);
+    const auto x = xDistribution(randomEngine);
+    return sf::Vector2f(x, yDistribution(randomEngine));
+}
@@ -0,0 +1,93 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <Game.hpp>
+#include <Assets.hpp>
+#include <helpers.hpp>
+#include <constants.hpp>
+#include <SceneManager.hpp>
+#include <scene/PlanetAssault.hpp>
+
+/**
+ * Synthetic planets for the benchmarks, entities are built the same way the game builds them.
+ */
+namespace nongravitar::bench::fixtures {
+    inline constexpr auto SEED = helpers::Seed{0x5eedu};
+
+    // a full-hd screen, the one headless games play on
+    inline const auto VIEWPORT = sf::FloatRect(0.0f, 0.0f, 1920.0f, 1080.0f);
+
+    // a tick at the nominal frame rate
+    inline const auto TICK = sf::seconds(1.0f / static_cast<float>(constants::FPS));
+
+    [[nodiscard]] sf::Color terrainColor() noexcept;
+
+    /**
+     * A planet initialized as in game, with a player landed on it from a solar system.
+     */
+    scene::PlanetAssault &emplacePlanet(SceneManager &sceneManager, const sf::FloatRect &viewport, Assets &assets);
+
+    /**
+     * Restore the health and the energy of the player, for runs in which it must never be the one to blow up.
+     */
+    void keepPlayerAlive(entt::registry &registry);
+
+    /**
+     * Move the ship of the solar system onto its first planet, the next tick lands it there.
+     *
+     * @return false if the current scene isn't the solar system or it has no planets left.
+     */
+    bool moveOntoPlanet(Game &game);
+
+    /**
+     * Move the ship of the current planet off screen, the next tick takes it back to the solar system.
+     *
+     * @return false if the current scene isn't a planet.
+     */
+    bool moveOffPlanet(Game &game);
+
+    /**
+     * Bullets in flight across the upper half of the viewport.
+     */
+    void addBullets(scene::PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                    helpers::RandomEngine &randomEngine, std::size_t count);
+
+    /**
+     * Bunkers across the lower half of the viewport, half AI1 and half AI2, ready to shoot every `reloadTime` seconds.
+     */
+    void addBunkers(scene::PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                    helpers::RandomEngine &randomEngine, std::size_t count, float reloadTime);
+
+    /**
+     * Supplies across the lower half of the viewport, half energy and half health.
+     */
+    void addSupplies(scene::PlanetAssault &planet, const sf::FloatRect &viewport, Assets &assets,
+                     helpers::RandomEngine &randomEngine, std::size_t count);
+}
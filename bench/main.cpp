@@ -0,0 +1,175 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Benchmarks of the game internals, grouped in suites:
+ *  - systems: the planet assault systems one at a time on synthetic registries of growing sizes;
+ *  - stress: whole planet assault ticks under growing load profiles, to spot scaling cliffs;
+ *  - startup: game startup and scene transitions latencies;
+ *  - soak: memory growth over a long session;
+ *  - allocations: heap allocations of steady-state ticks, which should be none;
+ *  - scheduler: serial and concurrent runs of the planet systems must reach the same state hash every tick.
+ *
+ * The results table goes to the standard error, the JSON results to the standard output unless --json is given.
+ * Exit status: 0 on success, 1 if the suite failed its guarantees, 2 on errors.
+ */
+
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <suites.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::bench;
+
+constexpr const char *SUITES[]{"systems", "stress", "startup", "soak", "allocations", "scheduler"};
+
+constexpr auto USAGE =
+        "Usage: nongravitar-bench <systems|stress|startup|soak|allocations|scheduler> [options]\r\n"
+        "  --json <file>        write the JSON results into a file instead of the standard output\r\n"
+        "  --samples <n>        samples of each systems measure, startups of the startup suite (default: 16)\r\n"
+        "  --around <n>         ticks timed before and after each scene transition (default: 8)\r\n"
+        "  --ticks <n>          ticks of each stress scenario, of the allocations and scheduler suites (default: 300)\r\n"
+        "  --budget <ms>        tick budget of the stress scenarios (default: one frame)\r\n"
+        "  --bunkers <n>        run a single stress scenario with the given amount of bunkers,\r\n"
+        "  --reload <seconds>   bunkers reload time,\r\n"
+        "  --supplies <n>       supplies,\r\n"
+        "  --length <pixels>    terrain length,\r\n"
+        "  --bullets <n>        and bullets in flight\r\n"
+        "  --solar-systems <n>  solar systems cleared by the soak (default: 64)\r\n"
+        "  --sampling <n>       solar systems between two samples of the soak (default: 8)\r\n"
+        "  --max-growth <%>     growth allowed to any soak sample between the first and the last (default: 10)\r\n";
+
+Settings parse(int argc, const char *const argv[]);
+
+int main(const int argc, const char *const argv[]) {
+    auto settings = Settings();
+
+    try {
+        settings = parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl << USAGE;
+        return 2;
+    }
+
+    auto benchmark = Benchmark();
+
+    auto passed = true;
+
+    if ("systems" == settings.suite) {
+        passed = suites::systems(benchmark, settings);
+    } else if ("stress" == settings.suite) {
+        passed = suites::stress(benchmark, settings);
+    } else if ("startup" == settings.suite) {
+        passed = suites::startup(benchmark, settings);
+    } else if ("soak" == settings.suite) {
+        passed = suites::soak(benchmark, settings);
+    } else if ("allocations" == settings.suite) {
+        passed = suites::allocations(benchmark, settings);
+    } else {
+        passed = suites::scheduler(benchmark, settings);
+    }
+
+    benchmark.writeTable(std::cerr);
+
+    if (settings.jsonPath.empty()) {
+        benchmark.writeJson(std::cout, settings.suite);
+    } else if (auto stream = std::ofstream(settings.jsonPath); stream) {
+        benchmark.writeJson(stream, settings.suite);
+    } else {
+        std::cerr << "Unable to write: " << settings.jsonPath << std::endl;
+        return 2;
+    }
+
+    return passed ? 0 : 1;
+}
+
+Settings parse(const int argc, const char *const argv[]) {
+    auto settings = Settings();
+    auto scenario = Scenario{"custom"};
+    auto isCustom = false;
+
+    if (argc < 2 or std::none_of(std::begin(SUITES), std::end(SUITES), [&](const auto suite) { return 0 == std::strcmp(argv[1], suite); })) {
+        throw std::invalid_argument("Missing or unknown suite");
+    }
+
+    settings.suite = argv[1];
+
+    for (auto i = 2; i < argc; i++) {
+        const auto argument = argv[i];
+        const auto value = [&]() {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument(std::string("Missing value for: ") + argument);
+            }
+            return std::string(argv[++i]);
+        };
+
+        if (0 == std::strcmp(argument, "--json")) {
+            settings.jsonPath = value();
+        } else if (0 == std::strcmp(argument, "--samples")) {
+            settings.samples = static_cast<unsigned>(std::stoul(value()));
+        } else if (0 == std::strcmp(argument, "--around")) {
+            settings.around = static_cast<unsigned>(std::stoul(value()));
+        } else if (0 == std::strcmp(argument, "--ticks")) {
+            settings.ticks = static_cast<unsigned>(std::stoul(value()));
+        } else if (0 == std::strcmp(argument, "--budget")) {
+            settings.budget = std::stof(value());
+        } else if (0 == std::strcmp(argument, "--solar-systems")) {
+            settings.solarSystems = static_cast<unsigned>(std::stoul(value()));
+        } else if (0 == std::strcmp(argument, "--sampling")) {
+            settings.sampling = std::max(static_cast<unsigned>(std::stoul(value())), 1u);
+        } else if (0 == std::strcmp(argument, "--max-growth")) {
+            settings.maxGrowth = std::stof(value());
+        } else if (0 == std::strcmp(argument, "--bunkers")) {
+            scenario.bunkers = std::stoul(value()), isCustom = true;
+        } else if (0 == std::strcmp(argument, "--reload")) {
+            scenario.reloadTime = std::stof(value()), isCustom = true;
+
+            if (not (scenario.reloadTime > 0.0f)) {
+                throw std::invalid_argument("The reload time must be positive");
+            }
+        } else if (0 == std::strcmp(argument, "--supplies")) {
+            scenario.supplies = std::stoul(value()), isCustom = true;
+        } else if (0 == std::strcmp(argument, "--length")) {
+            scenario.terrainLength = std::stof(value()), isCustom = true;
+        } else if (0 == std::strcmp(argument, "--bullets")) {
+            scenario.bullets = std::stoul(value()), isCustom = true;
+        } else {
+            throw std::invalid_argument(std::string("Unknown argument: ") + argument);
+        }
+    }
+
+    if (isCustom) {
+        settings.scenario = scenario;
+    }
+
+    return settings;
+}
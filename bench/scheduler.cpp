@@ -0,0 +1,132 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <tags.hpp>
+#include <Input.hpp>
+#include <Probe.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <StateHash.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+#include <allocations.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+// enough of everything for every system to have work on every tick
+constexpr auto BUNKERS = 256u;
+constexpr auto RELOAD_TIME = 0.5f;
+constexpr auto SUPPLIES = 64u;
+constexpr auto BULLETS = 1024u;
+
+struct Run final {
+    std::size_t entities{0u};
+    std::vector<std::uint64_t> durations;
+    std::vector<StateHash::Values> hashes; // one per tick
+};
+
+/**
+ * Play the same planet from scratch through the given pool, hashing it after every tick.
+ */
+Run run(Assets &assets, WorkerPool &workerPool, const unsigned ticks) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto &viewport = fixtures::VIEWPORT;
+    const auto elapsed = fixtures::TICK;
+    const auto input = Input();
+    auto sceneManager = SceneManager();
+    auto frameArena = FrameArena(FRAME_ARENA_CAPACITY);
+    auto randomEngine = helpers::RandomEngine(fixtures::SEED);
+    auto &planet = fixtures::emplacePlanet(sceneManager, viewport, assets);
+    auto &registry = Probe::getRegistry(planet);
+    auto result = Run();
+
+    fixtures::addBunkers(planet, viewport, assets, randomEngine, BUNKERS, RELOAD_TIME);
+    fixtures::addSupplies(planet, viewport, assets, randomEngine, SUPPLIES);
+    fixtures::addBullets(planet, viewport, assets, randomEngine, BULLETS);
+    result.entities = registry.alive();
+
+    for (auto tick = 0u; tick < ticks; tick++) {
+        fixtures::keepPlayerAlive(registry);
+
+        if (const auto inFlight = registry.view<Bullet>().size(); inFlight < BULLETS) {
+            fixtures::addBullets(planet, viewport, assets, randomEngine, BULLETS - inFlight);
+        }
+
+        const auto started = Clock::now();
+        planet.update(viewport, sceneManager, assets, frameArena, workerPool, input, elapsed);
+        result.durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count());
+        frameArena.reset();
+
+        auto hash = StateHash();
+        planet.hash(hash);
+        result.hashes.push_back(hash.getValues());
+    }
+
+    return result;
+}
+
+bool suites::scheduler(Benchmark &benchmark, const Settings &settings) {
+    if constexpr (allocations::isTracking()) {
+        std::cerr << "Systems never run concurrently while allocations are tracked, build with -DNONGRAVITAR_TRACK_ALLOCATIONS=OFF" << std::endl;
+        return false;
+    }
+
+    auto assets = Assets();
+    auto serialPool = WorkerPool(0u);
+    // a worker at least, the concurrent path must run even where there is no spare hardware thread
+    auto concurrentPool = WorkerPool(std::max(WorkerPool::spareWorkers(MAX_SYSTEM_WORKERS), std::size_t{1}));
+
+    assets.initialize(true);
+    auto serial = run(assets, serialPool, settings.ticks);
+    auto concurrent = run(assets, concurrentPool, settings.ticks);
+
+    benchmark.record("serial", serial.entities, std::move(serial.durations));
+    benchmark.record("concurrent (" + std::to_string(concurrentPool.getWorkers()) + " workers)", concurrent.entities, std::move(concurrent.durations));
+
+    for (auto tick = std::size_t{0}; tick < serial.hashes.size(); tick++) {
+        for (auto column = std::size_t{0}; column < StateHash::NAMES.size(); column++) {
+            if (serial.hashes[tick][column] != concurrent.hashes[tick][column]) {
+                std::cerr << "tick " << tick << ": the " << StateHash::NAMES[column]
+                          << " hash of the concurrent run differs from the serial one" << std::endl;
+                return false;
+            }
+        }
+    }
+
+    std::clog << "scheduler: " << serial.hashes.size() << " ticks, the concurrent run matches the serial one" << std::endl;
+    return true;
+}
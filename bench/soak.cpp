@@ -0,0 +1,198 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <map>
+#include <chrono>
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <tags.hpp>
+#include <Game.hpp>
+#include <Probe.hpp>
+#include <pubsub.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <messages.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::messages;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+using Sample = std::map<std::string, double>;
+
+/**
+ * Resident set size of the process in kB, 0 where it is not known.
+ */
+double residentKilobytes();
+
+Sample takeSample(Game &game);
+bool clearSolarSystem(Game &game, sf::Time elapsed);
+
+bool suites::soak(Benchmark &benchmark, const Settings &settings) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto elapsed = fixtures::TICK;
+    auto options = Options();
+    auto durations = std::vector<std::uint64_t>();
+    auto samples = std::vector<Sample>();
+
+    options.headless = true;
+    options.seed = fixtures::SEED;
+
+    auto game = std::make_unique<Game>(options);
+    game->initialize();
+
+    auto start = Input();
+    start.press(sf::Keyboard::Space);
+    Probe::step(*game, start, elapsed);
+
+    for (auto solarSystems = 1u; solarSystems <= settings.solarSystems; solarSystems++) {
+        const auto started = Clock::now();
+
+        if (not clearSolarSystem(*game, elapsed)) {
+            std::cerr << "Unable to clear solar system: " << solarSystems << std::endl;
+            return false;
+        }
+
+        durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count());
+
+        if (0u == solarSystems % settings.sampling) {
+            auto &sample = samples.emplace_back(takeSample(*game));
+            std::clog << "solar systems: " << solarSystems;
+            for (const auto &[name, value] : sample) {
+                benchmark.metric("soak/" + std::to_string(solarSystems) + "/" + name, value);
+                std::clog << ' ' << name << ": " << value;
+            }
+            std::clog << std::endl;
+        }
+    }
+
+    benchmark.record("soak/solar-system", 0u, std::move(durations));
+
+    if (samples.size() < 2u) {
+        std::clog << "not enough samples to measure any growth" << std::endl;
+        return true;
+    }
+
+    auto passed = true;
+    for (const auto &[name, first] : samples.front()) {
+        const auto last = samples.back().at(name);
+        const auto growth = 0.0 == first ? (0.0 == last ? 0.0 : 100.0) : 100.0 * (last - first) / first;
+
+        if (growth > settings.maxGrowth) {
+            std::clog << name << " grew by " << growth << "% (" << first << " -> " << last << ")" << std::endl;
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+double residentKilobytes() {
+#ifdef __linux__
+    auto statm = std::ifstream("/proc/self/statm");
+    auto size = 0.0, resident = 0.0;
+
+    if (statm >> size >> resident) {
+        return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / 1024.0;
+    }
+#endif
+    return 0.0;
+}
+
+Sample takeSample(Game &game) {
+    auto &sceneManager = Probe::getSceneManager(game);
+    auto sample = Sample();
+
+    sample["rss_kb"] = residentKilobytes();
+    sample["scenes"] = sceneManager.size();
+    sample["solar_system_entities"] = 0.0;
+    sample["planet_entities"] = 0.0;
+
+    for (auto i = std::size_t{0}; i < sceneManager.size(); i++) {
+        auto &scene = sceneManager.get(SceneId{i});
+
+        if (const auto solarSystem = dynamic_cast<SolarSystem *>(&scene); solarSystem) {
+            sample["solar_system_entities"] += Probe::getRegistry(*solarSystem).alive();
+        } else if (const auto planet = dynamic_cast<PlanetAssault *>(&scene); planet) {
+            sample["planet_entities"] += Probe::getRegistry(*planet).alive();
+        }
+    }
+
+    sample["planet_entered_handlers"] = pubsub::subscribers<PlanetEntered>();
+    sample["solar_system_entered_handlers"] = pubsub::subscribers<SolarSystemEntered>();
+    sample["game_over_handlers"] = pubsub::subscribers<GameOver>();
+    return sample;
+}
+
+/**
+ * Land on every planet, wipe its bunkers out and leave, until the solar system generates a new batch of planets.
+ */
+bool clearSolarSystem(Game &game, const sf::Time elapsed) {
+    auto &sceneManager = Probe::getSceneManager(game);
+    const auto solarSystemSceneId = Probe::getSolarSystemSceneId(game);
+    auto &solarSystem = dynamic_cast<SolarSystem &>(sceneManager.get(solarSystemSceneId));
+    auto &registry = Probe::getRegistry(solarSystem);
+    const auto scenes = sceneManager.size();
+
+    while (sceneManager.size() == scenes) {
+        if (solarSystemSceneId != Probe::getCurrentSceneId(game)) {
+            return false;
+        }
+
+        // the soak is about memory, the ship must never be the one to blow up
+        fixtures::keepPlayerAlive(registry);
+
+        if (fixtures::moveOntoPlanet(game)) {
+            Probe::step(game, Input(), elapsed);
+
+            const auto planet = dynamic_cast<PlanetAssault *>(&sceneManager.get(Probe::getCurrentSceneId(game)));
+            if (not planet) {
+                return false;
+            }
+
+            auto &planetRegistry = Probe::getRegistry(*planet);
+            const auto bunkers = planetRegistry.view<Bunker>();
+            planetRegistry.destroy(bunkers.begin(), bunkers.end());
+            fixtures::moveOffPlanet(game);
+        }
+
+        Probe::step(game, Input(), elapsed);
+    }
+
+    return true;
+}
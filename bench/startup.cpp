@@ -0,0 +1,171 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <map>
+#include <chrono>
+#include <memory>
+#include <iostream>
+#include <tags.hpp>
+#include <Game.hpp>
+#include <Probe.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+using Clock = std::chrono::steady_clock;
+using Durations = std::vector<std::uint64_t>;
+
+std::uint64_t nanoseconds(Clock::time_point started) noexcept;
+
+bool suites::startup(Benchmark &benchmark, const Settings &settings) {
+    const auto elapsed = fixtures::TICK;
+    auto initializations = Durations(), firstFrames = Durations();
+    auto transitions = std::map<std::string, Durations>(), worstAround = std::map<std::string, Durations>();
+    auto options = Options();
+    auto skipped = 0u;
+
+    // headless games are silent, they never open a window and they are driven by the benchmark only
+    options.headless = true;
+    options.seed = fixtures::SEED;
+
+    for (auto i = 0u; i < std::max(settings.samples, 1u); i++) {
+        auto started = Clock::now();
+        auto game = std::make_unique<Game>(options);
+        game->initialize();
+        initializations.push_back(nanoseconds(started));
+        Probe::step(*game, Input(), elapsed);
+        Probe::render(*game);
+        firstFrames.push_back(nanoseconds(started));
+
+        auto &sceneManager = Probe::getSceneManager(*game);
+        const auto solarSystemSceneId = Probe::getSolarSystemSceneId(*game);
+        auto &solarSystem = dynamic_cast<SolarSystem &>(sceneManager.get(solarSystemSceneId));
+
+        // idle ticks around the transition tick: the worst of them tells whether its cost spills over
+        const auto transition = [&](const std::string &name, const auto &prepare, const auto &hasTransitioned) {
+            auto worst = std::uint64_t{0u};
+            const auto idle = [&]() {
+                for (auto tick = 0u; tick < settings.around; tick++) {
+                    const auto tickStarted = Clock::now();
+                    Probe::step(*game, Input(), elapsed);
+                    worst = std::max(worst, nanoseconds(tickStarted));
+                }
+            };
+
+            idle();
+            const auto input = prepare();
+            const auto tickStarted = Clock::now();
+            Probe::step(*game, input, elapsed);
+            const auto duration = nanoseconds(tickStarted);
+
+            if (not hasTransitioned()) {
+                std::clog << "sample " << i << ": " << name << " didn't happen, the transitions after it are left out" << std::endl;
+                skipped += 1;
+                return false;
+            }
+
+            idle();
+            transitions[name].push_back(duration);
+            worstAround[name].push_back(worst);
+            return true;
+        };
+
+        const auto pressSpace = []() {
+            auto input = Input();
+            input.press(sf::Keyboard::Space);
+            return input;
+        };
+
+        // the ship is moved straight onto a planet, PlanetEntered moves it into the planet registry
+        const auto landOnPlanet = [&]() {
+            fixtures::moveOntoPlanet(*game);
+            return Input();
+        };
+
+        // the ship leaves the screen, SolarSystemEntered moves it back
+        const auto leavePlanet = [&]() {
+            fixtures::moveOffPlanet(*game);
+            return Input();
+        };
+
+        // with no planets left the solar system generates a new batch, each with its own planet assault
+        const auto destroyPlanets = [&]() {
+            auto &registry = Probe::getRegistry(solarSystem);
+            const auto planets = registry.view<Planet>();
+            registry.destroy(planets.begin(), planets.end());
+            return Input();
+        };
+
+        const auto scenes = sceneManager.size();
+        const auto isInSolarSystem = [&]() { return solarSystemSceneId == Probe::getCurrentSceneId(*game); };
+        const auto isOnPlanet = [&]() { return nullptr != dynamic_cast<PlanetAssault *>(&sceneManager.get(Probe::getCurrentSceneId(*game))); };
+        const auto hasNewPlanets = [&]() { return sceneManager.size() > scenes; };
+
+        // each transition starts from where the previous one landed, the sample stops at the first one that fails
+        if (not transition("title->solar-system", pressSpace, isInSolarSystem)) {
+            continue;
+        }
+
+        if (not transition("solar-system->planet", landOnPlanet, isOnPlanet)) {
+            continue;
+        }
+
+        if (not transition("planet->solar-system", leavePlanet, isInSolarSystem)) {
+            continue;
+        }
+
+        transition("reset-planets", destroyPlanets, hasNewPlanets);
+    }
+
+    benchmark.record("startup/cold", 0u, Durations(initializations.begin(), initializations.begin() + 1));
+    benchmark.record("startup/warm", 0u, Durations(initializations.begin() + 1, initializations.end()));
+    benchmark.record("first-frame/cold", 0u, Durations(firstFrames.begin(), firstFrames.begin() + 1));
+    benchmark.record("first-frame/warm", 0u, Durations(firstFrames.begin() + 1, firstFrames.end()));
+
+    for (auto &[name, durations] : transitions) {
+        benchmark.record("transition/" + name, 0u, std::move(durations));
+        benchmark.record("around/" + name, 0u, std::move(worstAround[name]));
+    }
+
+    if (0u != skipped) {
+        std::clog << skipped << " samples stopped at a transition that didn't happen as planned" << std::endl;
+    }
+
+    return true;
+}
+
+std::uint64_t nanoseconds(const Clock::time_point started) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count();
+}
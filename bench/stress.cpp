@@ -0,0 +1,142 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <tags.hpp>
+#include <Input.hpp>
+#include <Probe.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+// a profile gives up on heavier scenarios once a single tick is this many budgets long
+constexpr auto GIVE_UP_BUDGETS = 16.0f;
+
+std::vector<std::vector<Scenario>> makeProfiles();
+bool runScenario(Benchmark &benchmark, Assets &assets, const Settings &settings, const Scenario &scenario);
+
+bool suites::stress(Benchmark &benchmark, const Settings &settings) {
+    auto assets = Assets();
+    assets.initialize(true);
+
+    const auto profiles = settings.scenario ? std::vector<std::vector<Scenario>>{{*settings.scenario}} : makeProfiles();
+
+    for (const auto &profile : profiles) {
+        for (const auto &scenario : profile) {
+            if (not runScenario(benchmark, assets, settings, scenario)) {
+                std::clog << scenario.name << ": gave up, heavier scenarios of the profile are skipped" << std::endl;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::vector<std::vector<Scenario>> makeProfiles() {
+    auto profiles = std::vector<std::vector<Scenario>>(5u);
+
+    for (const auto bullets : {100u, 1'000u, 10'000u, 100'000u}) {
+        profiles[0].push_back(Scenario{"bullets/" + std::to_string(bullets), 8u, 1.0f, 8u, fixtures::VIEWPORT.width, bullets});
+    }
+
+    for (const auto bunkers : {16u, 128u, 1'024u, 8'192u}) {
+        profiles[1].push_back(Scenario{"bunkers/" + std::to_string(bunkers), bunkers, 0.5f, 8u, fixtures::VIEWPORT.width, 0u});
+    }
+
+    for (const auto shotsPerSecond : {1u, 4u, 16u, 60u}) {
+        profiles[2].push_back(Scenario{"fire-rate/" + std::to_string(shotsPerSecond), 256u, 1.0f / shotsPerSecond, 8u, fixtures::VIEWPORT.width, 0u});
+    }
+
+    for (const auto supplies : {16u, 256u, 4'096u}) {
+        profiles[3].push_back(Scenario{"supplies/" + std::to_string(supplies), 8u, 1.0f, supplies, fixtures::VIEWPORT.width, 100u});
+    }
+
+    for (const auto screens : {1u, 4u, 16u, 64u}) {
+        profiles[4].push_back(Scenario{"terrain/" + std::to_string(screens), 8u, 1.0f, 8u, fixtures::VIEWPORT.width * screens, 100u});
+    }
+
+    return profiles;
+}
+
+/**
+ * Time every tick of the scenario, returns false if it was too slow to be worth running heavier ones.
+ */
+bool runScenario(Benchmark &benchmark, Assets &assets, const Settings &settings, const Scenario &scenario) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto viewport = sf::FloatRect(0.0f, 0.0f, scenario.terrainLength, fixtures::VIEWPORT.height);
+    const auto elapsed = fixtures::TICK;
+    const auto input = Input();
+    auto sceneManager = SceneManager();
+    auto frameArena = FrameArena(FRAME_ARENA_CAPACITY);
+    auto workerPool = WorkerPool(WorkerPool::spareWorkers(MAX_SYSTEM_WORKERS));
+    auto randomEngine = helpers::RandomEngine(fixtures::SEED);
+    auto &planet = fixtures::emplacePlanet(sceneManager, viewport, assets);
+    auto &registry = Probe::getRegistry(planet);
+
+    fixtures::addBunkers(planet, viewport, assets, randomEngine, scenario.bunkers, scenario.reloadTime);
+    fixtures::addSupplies(planet, viewport, assets, randomEngine, scenario.supplies);
+    fixtures::addBullets(planet, viewport, assets, randomEngine, scenario.bullets);
+
+    // the player never dies and the bullets gone are shot again, so that the load stays the same
+    const auto keepLoad = [&]() {
+        fixtures::keepPlayerAlive(registry);
+
+        if (const auto inFlight = registry.view<Bullet>().size(); inFlight < scenario.bullets) {
+            fixtures::addBullets(planet, viewport, assets, randomEngine, scenario.bullets - inFlight);
+        }
+    };
+    const auto tick = [&]() {
+        planet.update(viewport, sceneManager, assets, frameArena, workerPool, input, elapsed);
+        frameArena.reset();
+    };
+
+    // a first tick tells whether the whole run would take forever
+    const auto entities = registry.alive();
+    const auto started = Clock::now();
+    tick();
+    const auto warmUp = std::chrono::duration<float, std::milli>(Clock::now() - started).count();
+    const auto givesUp = warmUp > GIVE_UP_BUDGETS * settings.budget;
+
+    const auto &result = benchmark.measure(scenario.name, entities, givesUp ? 1u : settings.ticks, keepLoad, tick);
+    const auto p90 = static_cast<float>(result.p90Ns) / 1'000'000.0f;
+
+    std::clog << scenario.name << ": " << entities << " entities, p90 " << p90 << "ms"
+              << (p90 > settings.budget ? " (over budget)" : "") << std::endl;
+    return not givesUp;
+}
@@ -0,0 +1,101 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <optional>
+#include <constants.hpp>
+#include <Benchmark.hpp>
+
+namespace nongravitar::bench {
+    /**
+     * Load profile of a planet assault, counts are kept steady for the whole run.
+     */
+    struct Scenario final {
+        std::string name;
+        std::size_t bunkers{0u};
+        float reloadTime{1.0f}; // seconds between two shots of the same bunker
+        std::size_t supplies{0u};
+        float terrainLength{1920.0f}; // the terrain spans the whole viewport width
+        std::size_t bullets{0u}; // bullets in flight, the ones gone are shot again before every tick
+    };
+
+    struct Settings final {
+        std::string suite;
+        std::string jsonPath;
+        unsigned samples{16u};
+        unsigned around{8u}; // ticks timed before and after each scene transition
+        unsigned ticks{300u};
+        float budget{1000.0f / constants::FPS}; // milliseconds per tick
+        std::optional<Scenario> scenario;
+        unsigned solarSystems{64u}; // solar systems cleared by the soak
+        unsigned sampling{8u}; // solar systems between two samples of the soak
+        float maxGrowth{10.0f}; // percent
+    };
+}
+
+/**
+ * Each suite adds its measures to the benchmark, they all share the same output.
+ * A suite returns false when the measures break one of its guarantees.
+ */
+namespace nongravitar::bench::suites {
+    /**
+     * The planet assault systems one at a time, on synthetic registries of growing sizes.
+     */
+    bool systems(Benchmark &benchmark, const Settings &settings);
+
+    /**
+     * Whole planet assault ticks under growing loads, either the built-in profiles or the given scenario only.
+     */
+    bool stress(Benchmark &benchmark, const Settings &settings);
+
+    /**
+     * Cold and warm startups of a headless game, then each scene transition with the worst tick around it.
+     * Only the first startup of a process is cold, so it makes sense to run this suite on its own.
+     */
+    bool startup(Benchmark &benchmark, const Settings &settings);
+
+    /**
+     * A long headless session clearing solar system after solar system, sampling memory usage, entities, scenes and
+     * subscribed handlers; it fails if any of them grows more than allowed between the first and the last sample.
+     */
+    bool soak(Benchmark &benchmark, const Settings &settings);
+
+    /**
+     * Steady-state planet assault ticks after a warm-up, reporting the heap allocations of every tick and system.
+     * It fails if any of those ticks allocated, or if the build doesn't track allocations.
+     */
+    bool allocations(Benchmark &benchmark, const Settings &settings);
+
+    /**
+     * The same loaded planet played through a pool without workers, the serial fallback, and then through one with
+     * workers, timing the ticks of both. It fails on the first tick whose state hash differs between the two runs.
+     */
+    bool scheduler(Benchmark &benchmark, const Settings &settings);
+}
@@ -0,0 +1,143 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <tags.hpp>
+#include <Probe.hpp>
+#include <suites.hpp>
+#include <fixtures.hpp>
+#include <messages.hpp>
+#include <constants.hpp>
+#include <components.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::bench;
+using namespace nongravitar::scene;
+using namespace nongravitar::messages;
+using namespace nongravitar::constants;
+using namespace nongravitar::components;
+
+constexpr std::size_t ENTITIES[]{16u, 64u, 256u, 1024u, 4096u};
+
+struct GameOverSink final : public pubsub::Handler<GameOver> {
+    GameOverSink() {
+        pubsub::subscribe<GameOver>(*this);
+    }
+
+    void operator()(const GameOver &message) noexcept final {
+        score += message.score;
+    }
+
+    unsigned score{0u};
+};
+
+bool suites::systems(Benchmark &benchmark, const Settings &settings) {
+    const auto &viewport = fixtures::VIEWPORT;
+    const auto elapsed = fixtures::TICK;
+    const auto samples = settings.samples;
+    auto sceneManager = SceneManager();
+    auto randomEngine = helpers::RandomEngine(fixtures::SEED);
+    auto assets = Assets();
+    auto frameArena = FrameArena(FRAME_ARENA_CAPACITY);
+    PlanetAssault *planet = nullptr;
+
+    assets.initialize(true);
+
+    // every sample starts from a brand new planet, the previous one is dropped
+    const auto resetPlanet = [&]() {
+        sceneManager.truncate(0u);
+        planet = &fixtures::emplacePlanet(sceneManager, viewport, assets);
+        randomEngine = helpers::RandomEngine(fixtures::SEED);
+    };
+
+    for (const auto entities : ENTITIES) {
+        benchmark.measure("motionSystem", entities, samples, [&]() {
+            resetPlanet();
+            fixtures::addBullets(*planet, viewport, assets, randomEngine, entities);
+        }, [&]() { Probe::motionSystem(*planet, elapsed); });
+
+        benchmark.measure("collisionSystem", entities, samples, [&]() {
+            resetPlanet();
+            fixtures::addBullets(*planet, viewport, assets, randomEngine, entities);
+        }, [&]() { Probe::collisionSystem(*planet, viewport, assets, elapsed); });
+
+        benchmark.measure("AISystem", entities, samples, [&]() {
+            resetPlanet();
+            fixtures::addBunkers(*planet, viewport, assets, randomEngine, entities, 1.0f);
+        }, [&]() {
+            // the bullets are spawned by the command system, as they are on a whole tick
+            Probe::AISystem(*planet);
+            Probe::commandSystem(*planet, viewport, assets);
+        });
+
+        benchmark.measure("livenessSystem", entities, samples, [&]() {
+            resetPlanet();
+            fixtures::addBullets(*planet, viewport, assets, randomEngine, entities);
+
+            auto i = 0u; // half of the bullets are gone, marked dirty as the collision system does
+            auto &registry = Probe::getRegistry(*planet);
+            registry.view<Bullet, Health>().each([&](const auto bulletId, const auto, auto &health) {
+                if (0u == i++ % 2u) {
+                    health.kill();
+                    registry.assign<Dirty>(bulletId);
+                }
+            });
+        }, [&]() {
+            // the bullets are destroyed by the command system, as they are on a whole tick
+            Probe::livenessSystem(*planet, assets, frameArena);
+            Probe::commandSystem(*planet, viewport, assets);
+            frameArena.reset();
+        });
+
+        benchmark.measure("reloadSystem", entities, samples, [&]() {
+            resetPlanet();
+            fixtures::addBunkers(*planet, viewport, assets, randomEngine, entities, 1.0f);
+        }, [&]() { Probe::reloadSystem(*planet, elapsed); });
+
+        benchmark.measure("shoot", entities, samples, [&]() {
+            resetPlanet();
+        }, [&]() {
+            auto &registry = Probe::getRegistry(*planet);
+            for (auto i = 0u; i < entities; i++) {
+                Probe::shoot(registry, assets, sf::Vector2f(viewport.width / 2.0f, viewport.height / 2.0f), static_cast<float>(i % 360u));
+            }
+        });
+
+        auto sinks = std::vector<GameOverSink>(entities);
+        benchmark.measure("pubsub::publish", entities, samples, []() {}, []() { pubsub::publish<GameOver>(1u); });
+    }
+
+    // the amount of terrain depends on the viewport only, so there is a single size to measure
+    auto &terrain = benchmark.measure("initializeTerrain", 0u, samples, [&]() {
+        sceneManager.truncate(0u);
+        planet = &sceneManager.emplace<PlanetAssault>(nullSceneId, nullSceneId, fixtures::SEED);
+        Probe::initializeGroups(*planet);
+    }, [&]() { Probe::initializeTerrain(*planet, viewport, assets, fixtures::terrainColor()); });
+    terrain.entities = Probe::getRegistry(*planet).alive();
+
+    return true;
+}
@@ -0,0 +1,303 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <tags.hpp>
+#include <Archive.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::assets;
+using namespace nongravitar::components;
+
+/*
+ * Every component that may live in a scene registry.
+ *
+ * Pools owned by a group come last, each one after the pools its group observes: the loader assigns components in
+ * the order they were saved, so the owned pools are rebuilt with the group members already packed on front and end
+ * up exactly as they were. Iteration order is as much part of the simulation state as the components are.
+ */
+using Components = std::tuple<
+        Approached, Dirty, Hidden, Planet, Bunker, HitRadius, ReloadTime, EntityRef<Player>, EntityRef<Tractor>, Score, Energy, SceneRef,
+        Renderable, Velocity, Health, Damage, Player, Terrain, Tractor, Bullet, Supply<Energy>, Supply<Health>, AI1, AI2
+>;
+
+template<typename ...Components>
+void snapshot(const entt::registry &registry, OutputArchive &archive, std::tuple<Components...> *) {
+    registry.snapshot().entities(archive).destroyed(archive).component<Components...>(archive);
+}
+
+/*
+ * OutputArchive
+ */
+
+void OutputArchive::clear() noexcept {
+    mBuffer.clear();
+}
+
+void OutputArchive::write(const entt::registry &registry) {
+    snapshot(registry, *this, static_cast<Components *>(nullptr));
+}
+
+void OutputArchive::write(const helpers::RandomEngine &randomEngine) {
+    write(randomEngine.getState());
+}
+
+void OutputArchive::write(const TimerQueue &timerQueue) {
+    const auto &timers = timerQueue.getTimers();
+
+    // field by field, a timer as a whole has padding bytes that would make equal states differ
+    write(static_cast<std::int64_t>(timerQueue.getNow().asMicroseconds()));
+    write(static_cast<std::uint64_t>(timers.size()));
+    for (const auto &timer : timers) {
+        write(static_cast<std::int64_t>(timer.due.asMicroseconds()));
+        write(timer.entity);
+    }
+}
+
+const std::vector<char> &OutputArchive::getBuffer() const noexcept {
+    return mBuffer;
+}
+
+void OutputArchive::operator()(const std::uint32_t size) {
+    write(size);
+}
+
+void OutputArchive::operator()(const entt::entity entity) {
+    write(entity);
+}
+
+void OutputArchive::writeComponent(const Velocity &velocity) {
+    write(velocity.value);
+}
+
+void OutputArchive::writeComponent(const Score &score) {
+    write(score.value);
+}
+
+void OutputArchive::writeComponent(const Damage &damage) {
+    write(damage.getValue());
+}
+
+void OutputArchive::writeComponent(const Health &health) {
+    write(health.getValue());
+}
+
+void OutputArchive::writeComponent(const Energy &energy) {
+    write(energy.getValue());
+}
+
+void OutputArchive::writeComponent(const Supply<Health> &supply) {
+    write(supply->getValue());
+}
+
+void OutputArchive::writeComponent(const Supply<Energy> &supply) {
+    write(supply->getValue());
+}
+
+void OutputArchive::writeComponent(const SceneRef &sceneRef) {
+    write(*sceneRef);
+}
+
+void OutputArchive::writeComponent(const ReloadTime &reloadTime) {
+    write(reloadTime.getSecondsBeforeShoot());
+    write(reloadTime.getElapsed());
+}
+
+void OutputArchive::writeComponent(const HitRadius &hitRadius) {
+    write(*hitRadius);
+}
+
+void OutputArchive::writeComponent(const Renderable &renderable) {
+    write(renderable.getShape());
+    write(static_cast<std::uint8_t>(renderable.getSpriteSheetId()));
+    write(static_cast<std::uint16_t>(renderable.getFrameIndex()));
+    write(renderable.getRadius());
+    write(renderable.getColor());
+    write(renderable.getPosition());
+    write(renderable.getRotation());
+}
+
+/*
+ * InputArchive
+ */
+
+InputArchive::InputArchive(const char *const data, const std::size_t size) noexcept
+        : mData(data), mSize(size) {}
+
+void InputArchive::read(entt::registry &registry) {
+    assign(registry, static_cast<Components *>(nullptr));
+}
+
+void InputArchive::read(helpers::RandomEngine &randomEngine) {
+    randomEngine.setState(read<helpers::RandomEngine::State>());
+}
+
+void InputArchive::read(TimerQueue &timerQueue) {
+    const auto now = sf::microseconds(read<std::int64_t>());
+    const auto count = read<std::uint64_t>();
+    auto timers = std::vector<TimerQueue::Timer>();
+
+    expect(count, sizeof(std::int64_t) + sizeof(entt::entity));
+    timers.reserve(count);
+
+    for (auto i = std::uint64_t{0}; i < count; i++) {
+        const auto due = sf::microseconds(read<std::int64_t>());
+        timers.push_back(TimerQueue::Timer{due, read<entt::entity>()});
+    }
+
+    timerQueue.assign(now, std::move(timers));
+}
+
+bool InputArchive::isOver() const noexcept {
+    return mCursor == mSize;
+}
+
+void InputArchive::expect(const std::uint64_t count, const std::size_t size) const {
+    if ((mSize - mCursor) / size < count) {
+        throw std::runtime_error(trace("Truncated archive"));
+    }
+}
+
+void InputArchive::operator()(std::uint32_t &size) {
+    read(size);
+}
+
+void InputArchive::operator()(entt::entity &entity) {
+    read(entity);
+}
+
+template<typename ...Components>
+void InputArchive::assign(entt::registry &registry, std::tuple<Components...> *) {
+    // the loader destroys the entities in the order they were saved, pushing each one on top of the free list:
+    // fed in reverse, the free list comes out as it was and entities are recycled in the same order as before.
+    struct Reversed final {
+        void operator()(std::uint32_t &size) const noexcept {
+            size = static_cast<std::uint32_t>(entities.size());
+        }
+
+        void operator()(entt::entity &entity) noexcept {
+            entity = entities.back();
+            entities.pop_back();
+        }
+
+        std::vector<entt::entity> entities;
+    };
+
+    const auto loader = registry.loader();
+    loader.entities(*this);
+
+    const auto count = read<std::uint32_t>();
+    expect(count, sizeof(entt::entity));
+
+    auto destroyed = Reversed{std::vector<entt::entity>(count)};
+    for (auto &entity : destroyed.entities) {
+        read(entity);
+    }
+    loader.destroyed(destroyed);
+
+    // the loader would want default-constructible components, ours are not:
+    // they are assigned here following the very same layout of the snapshot.
+
+    ([&]() {
+        for (auto length = read<std::uint32_t>(); length; --length) {
+            const auto entity = read<entt::entity>();
+
+            if constexpr (std::is_empty_v<Components>) {
+                registry.assign<Components>(entity);
+            } else {
+                registry.assign<Components>(entity, readComponent(std::in_place_type<Components>));
+            }
+        }
+    }(), ...);
+}
+
+Velocity InputArchive::readComponent(std::in_place_type_t<Velocity>) {
+    return Velocity{read<sf::Vector2f>()};
+}
+
+Score InputArchive::readComponent(std::in_place_type_t<Score>) {
+    return Score{read<unsigned>()};
+}
+
+Damage InputArchive::readComponent(std::in_place_type_t<Damage>) {
+    return Damage(read<int>());
+}
+
+Health InputArchive::readComponent(std::in_place_type_t<Health>) {
+    return Health(read<int>());
+}
+
+Energy InputArchive::readComponent(std::in_place_type_t<Energy>) {
+    return Energy(read<float>());
+}
+
+Supply<Health> InputArchive::readComponent(std::in_place_type_t<Supply<Health>>) {
+    return Supply<Health>(read<int>());
+}
+
+Supply<Energy> InputArchive::readComponent(std::in_place_type_t<Supply<Energy>>) {
+    return Supply<Energy>(read<float>());
+}
+
+SceneRef InputArchive::readComponent(std::in_place_type_t<SceneRef>) {
+    return SceneRef(read<SceneId>());
+}
+
+ReloadTime InputArchive::readComponent(std::in_place_type_t<ReloadTime>) {
+    const auto secondsBeforeShoot = read<float>();
+    return ReloadTime(secondsBeforeShoot, read<float>());
+}
+
+HitRadius InputArchive::readComponent(std::in_place_type_t<HitRadius>) {
+    return HitRadius(read<float>());
+}
+
+Renderable InputArchive::readComponent(std::in_place_type_t<Renderable>) {
+    const auto shape = read<Renderable::Shape>();
+    const auto spriteSheetId = SpriteSheetId(read<std::uint8_t>());
+    const auto frameIndex = read<std::uint16_t>();
+    const auto radius = read<float>();
+    const auto color = read<sf::Color>();
+    const auto position = read<sf::Vector2f>();
+    const auto rotation = read<float>();
+    auto renderable = [&]() {
+        switch (shape) {
+            case Renderable::Shape::Sprite:
+                return Renderable::sprite(spriteSheetId, frameIndex, color);
+            case Renderable::Shape::Disc:
+                return Renderable::disc(radius, color);
+            case Renderable::Shape::Ring:
+                return Renderable::ring(radius, color);
+            default:
+                throw std::runtime_error(trace("Unknown renderable shape"));
+        }
+    }();
+
+    renderable.setPosition(position);
+    renderable.setRotation(rotation);
+    return renderable;
+}
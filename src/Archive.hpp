@@ -0,0 +1,194 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <entt/entt.hpp>
+#include <trace.hpp>
+#include <helpers.hpp>
+#include <components.hpp>
+#include <TimerQueue.hpp>
+
+namespace nongravitar {
+    /**
+     * Dumps the state of a scene into a flat binary buffer, registries are dumped through EnTT snapshots.
+     *
+     * Entities keep their identifiers (versions and free list included) so that EntityRef components stay valid
+     * and entities are recycled in the very same order once restored. Values are stored with the native layout
+     * and sprite sheets by id, so a buffer is meant to be restored by the same build that wrote it.
+     */
+    class OutputArchive final {
+    public:
+        OutputArchive() = default; // default-constructible
+
+        OutputArchive(const OutputArchive &) = delete; // no copy-constructible
+        OutputArchive &operator=(const OutputArchive &) = delete; // no copy-assignable
+
+        OutputArchive(OutputArchive &&) = delete; // no move-constructible
+        OutputArchive &operator=(OutputArchive &&) = delete; // no move-assignable
+
+        /**
+         * Discard the content of the buffer retaining its capacity.
+         */
+        void clear() noexcept;
+
+        void write(const entt::registry &registry);
+        void write(const helpers::RandomEngine &randomEngine);
+        void write(const TimerQueue &timerQueue);
+
+        template<typename T>
+        void write(const T &value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto offset = mBuffer.size();
+            mBuffer.resize(offset + sizeof(T));
+            std::memcpy(mBuffer.data() + offset, &value, sizeof(T));
+        }
+
+        [[nodiscard]] const std::vector<char> &getBuffer() const noexcept;
+
+        // EnTT snapshot protocol
+        void operator()(std::uint32_t size);
+        void operator()(entt::entity entity);
+
+        template<typename Component>
+        void operator()(const entt::entity entity, const Component &component) {
+            write(entity);
+            writeComponent(component);
+        }
+
+    private:
+        void writeComponent(const components::Velocity &velocity);
+        void writeComponent(const components::Score &score);
+        void writeComponent(const components::Damage &damage);
+        void writeComponent(const components::Health &health);
+        void writeComponent(const components::Energy &energy);
+        void writeComponent(const components::Supply<components::Health> &supply);
+        void writeComponent(const components::Supply<components::Energy> &supply);
+        void writeComponent(const components::SceneRef &sceneRef);
+        void writeComponent(const components::ReloadTime &reloadTime);
+        void writeComponent(const components::HitRadius &hitRadius);
+        void writeComponent(const components::Renderable &renderable);
+
+        template<typename T>
+        void writeComponent(const components::EntityRef<T> &entityRef) {
+            write(*entityRef);
+        }
+
+        std::vector<char> mBuffer;
+    };
+
+    class InputArchive final {
+    public:
+        InputArchive() = delete; // no default-constructible
+
+        /**
+         * @warning
+         *  The buffer is not copied, it must outlive this object.
+         */
+        InputArchive(const char *data, std::size_t size) noexcept;
+
+        InputArchive(const InputArchive &) = delete; // no copy-constructible
+        InputArchive &operator=(const InputArchive &) = delete; // no copy-assignable
+
+        InputArchive(InputArchive &&) = delete; // no move-constructible
+        InputArchive &operator=(InputArchive &&) = delete; // no move-assignable
+
+        /**
+         * Replace the whole content of the registry with the one stored in the archive.
+         */
+        void read(entt::registry &registry);
+        void read(helpers::RandomEngine &randomEngine);
+        void read(TimerQueue &timerQueue);
+
+        /**
+         * @throws std::runtime_error if the archive is over.
+         */
+        template<typename T>
+        void read(T &value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            if (mSize - mCursor < sizeof(T)) {
+                throw std::runtime_error(trace("Truncated archive"));
+            }
+
+            std::memcpy(&value, mData + mCursor, sizeof(T));
+            mCursor += sizeof(T);
+        }
+
+        template<typename T>
+        [[nodiscard]] T read() {
+            auto value = T{};
+            read(value);
+            return value;
+        }
+
+        [[nodiscard]] bool isOver() const noexcept;
+
+        // EnTT loader protocol
+        void operator()(std::uint32_t &size);
+        void operator()(entt::entity &entity);
+
+    private:
+        /**
+         * Check that what is left of the archive can hold count values of size bytes, before making room for them.
+         *
+         * @throws std::runtime_error if it can't.
+         */
+        void expect(std::uint64_t count, std::size_t size) const;
+
+        template<typename ...Components>
+        void assign(entt::registry &registry, std::tuple<Components...> *);
+
+        components::Velocity readComponent(std::in_place_type_t<components::Velocity>);
+        components::Score readComponent(std::in_place_type_t<components::Score>);
+        components::Damage readComponent(std::in_place_type_t<components::Damage>);
+        components::Health readComponent(std::in_place_type_t<components::Health>);
+        components::Energy readComponent(std::in_place_type_t<components::Energy>);
+        components::Supply<components::Health> readComponent(std::in_place_type_t<components::Supply<components::Health>>);
+        components::Supply<components::Energy> readComponent(std::in_place_type_t<components::Supply<components::Energy>>);
+        components::SceneRef readComponent(std::in_place_type_t<components::SceneRef>);
+        components::ReloadTime readComponent(std::in_place_type_t<components::ReloadTime>);
+        components::HitRadius readComponent(std::in_place_type_t<components::HitRadius>);
+        components::Renderable readComponent(std::in_place_type_t<components::Renderable>);
+
+        template<typename T>
+        components::EntityRef<T> readComponent(std::in_place_type_t<components::EntityRef<T>>) {
+            return components::EntityRef<T>(read<entt::entity>());
+        }
+
+        const char *mData;
+        std::size_t mSize;
+        std::size_t mCursor{0u};
+    };
+}
@@ -30,11 +30,18 @@
 using namespace nongravitar;
 using namespace nongravitar::assets;
 
-void Assets::initialize() {
+void Assets::initialize(const bool silent) {
     mFontsManager.initialize();
-    mAudioManager.initialize();
+
+    if (silent) {
+        mAudioManager.setSilent(true);
+    } else {
+        mAudioManager.initialize();
+    }
+
     mTexturesManager.initialize();
     mSpriteSheetsManager.initialize(mTexturesManager);
+    mPrefabsManager.initialize(mSpriteSheetsManager);
 }
 
 const SpriteSheetsManager &Assets::getSpriteSheetsManager() const noexcept {
@@ -52,3 +59,11 @@ const FontsManager &Assets::getFontsManager() const noexcept {
 AudioManager &Assets::getAudioManager() noexcept {
     return mAudioManager;
 }
+
+PrefabsManager &Assets::getPrefabsManager() noexcept {
+    return mPrefabsManager;
+}
+
+const PrefabsManager &Assets::getPrefabsManager() const noexcept {
+    return mPrefabsManager;
+}
@@ -29,6 +29,7 @@
 
 #include <assets/AudioManager.hpp>
 #include <assets/FontsManager.hpp>
+#include <assets/PrefabsManager.hpp>
 #include <assets/TexturesManager.hpp>
 #include <assets/SpriteSheetsManager.hpp>
 
@@ -44,23 +45,26 @@ namespace nongravitar {
         Assets &operator=(Assets &&) = delete; // no move-assignable
 
         /**
-         * Initialize assets loading them into memory.
+         * Initialize assets loading them into memory, audio is not even loaded when silent.
          *
          * @warning
          *  This method should be called exactly once in the life-cycle of this object, any usage of this object
          *  without proper initialization will result in a error.
          */
-        void initialize();
+        void initialize(bool silent);
 
         [[nodiscard]] const assets::SpriteSheetsManager &getSpriteSheetsManager() const noexcept;
         [[nodiscard]] const assets::TexturesManager &getTexturesManager() const noexcept;
         [[nodiscard]] const assets::FontsManager &getFontsManager() const noexcept;
         [[nodiscard]] assets::AudioManager &getAudioManager() noexcept;
+        [[nodiscard]] assets::PrefabsManager &getPrefabsManager() noexcept;
+        [[nodiscard]] const assets::PrefabsManager &getPrefabsManager() const noexcept;
 
     private:
         assets::SpriteSheetsManager mSpriteSheetsManager;
         assets::TexturesManager mTexturesManager;
         assets::FontsManager mFontsManager;
         assets::AudioManager mAudioManager;
+        assets::PrefabsManager mPrefabsManager;
     };
 }
@@ -0,0 +1,145 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <entt/entt.hpp>
+#include <helpers.hpp>
+#include <SystemScheduler.hpp>
+
+namespace nongravitar::resources {
+    /**
+     * The entities of a registry: creating or destroying them may change any pool, the systems doing it write them.
+     */
+    struct Entities;
+}
+
+namespace nongravitar {
+    /**
+     * The registry as seen by a scheduled system.
+     *
+     * Const components are read, the others are written. On debug builds every access is checked against what the
+     * system running on the calling thread declared, and an undeclared one aborts; release builds forward straight to
+     * the registry.
+     */
+    class CheckedRegistry final {
+    public:
+        CheckedRegistry() = delete; // no default-constructible
+
+        explicit CheckedRegistry(entt::registry &registry) noexcept : mRegistry{registry} {}
+
+        CheckedRegistry(const CheckedRegistry &) = delete; // no copy-constructible
+        CheckedRegistry &operator=(const CheckedRegistry &) = delete; // no copy-assignable
+
+        CheckedRegistry(CheckedRegistry &&) = delete; // no move-constructible
+        CheckedRegistry &operator=(CheckedRegistry &&) = delete; // no move-assignable
+
+        template<typename ...Component>
+        [[nodiscard]] auto view() {
+            check<const resources::Entities, Component...>();
+            return mRegistry.view<Component...>();
+        }
+
+        /**
+         * Excluded components are read, entities get in and out of the group as they come and go.
+         */
+        template<typename ...Owned, typename ...Get, typename ...Exclude>
+        [[nodiscard]] auto group(entt::get_t<Get...> = {}, entt::exclude_t<Exclude...> = {}) {
+            check<const resources::Entities, Owned..., Get..., const Exclude...>();
+            return mRegistry.group<Owned...>(entt::get<Get...>, entt::exclude<Exclude...>);
+        }
+
+        template<typename ...Component>
+        [[nodiscard]] decltype(auto) get(const entt::entity entity) {
+            check<Component...>();
+
+            if constexpr (1u == sizeof...(Component)) {
+                return (static_cast<Component &>(mRegistry.get<std::remove_const_t<Component>>(entity)), ...);
+            } else {
+                return std::tuple<Component &...>(mRegistry.get<std::remove_const_t<Component>>(entity)...);
+            }
+        }
+
+        template<typename Component>
+        [[nodiscard]] Component *try_get(const entt::entity entity) {
+            check<Component>();
+            return mRegistry.try_get<std::remove_const_t<Component>>(entity);
+        }
+
+        template<typename ...Component>
+        [[nodiscard]] bool has(const entt::entity entity) {
+            check<const Component...>();
+            return mRegistry.has<std::remove_const_t<Component>...>(entity);
+        }
+
+        [[nodiscard]] bool valid(const entt::entity entity) {
+            check<const resources::Entities>();
+            return mRegistry.valid(entity);
+        }
+
+        template<typename Component, typename ...Args>
+        decltype(auto) assign_or_replace(const entt::entity entity, Args &&... args) {
+            check<Component>();
+            return mRegistry.assign_or_replace<Component>(entity, std::forward<Args>(args)...);
+        }
+
+        template<typename Component>
+        void reset(const entt::entity entity) {
+            check<Component>();
+            mRegistry.reset<Component>(entity);
+        }
+
+        template<typename Component>
+        void remove(const entt::entity entity) {
+            check<Component>();
+            mRegistry.remove<Component>(entity);
+        }
+
+        /**
+         * The registry itself, for the system writing the entities: anything can change when it does.
+         */
+        [[nodiscard]] entt::registry &unchecked() {
+            check<resources::Entities>();
+            return mRegistry;
+        }
+
+    private:
+        template<typename ...Resources>
+        static void check() noexcept {
+            helpers::debug([]() {
+                using S = SystemScheduler;
+                auto writes = S::Access();
+                ((writes |= std::is_const_v<Resources> ? S::Access() : S::access<Resources>()), ...);
+                S::check(S::access<Resources...>(), writes);
+            });
+        }
+
+        entt::registry &mRegistry;
+    };
+}
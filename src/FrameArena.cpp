@@ -0,0 +1,90 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <FrameArena.hpp>
+
+using namespace nongravitar;
+
+FrameArena::FrameArena(const std::size_t capacity) :
+        mBuffer{std::make_unique<std::byte[]>(capacity)},
+        mCapacity{capacity} {}
+
+FrameArena::~FrameArena() {
+    for (const auto &overflow : mOverflows) {
+        std::pmr::new_delete_resource()->deallocate(overflow.pointer, overflow.bytes, overflow.alignment);
+    }
+}
+
+void FrameArena::reset() {
+    if (not mOverflows.empty()) {
+        for (const auto &overflow : mOverflows) {
+            std::pmr::new_delete_resource()->deallocate(overflow.pointer, overflow.bytes, overflow.alignment);
+        }
+
+        // make room for the whole peak, with some slack for the alignment paddings
+        mOverflows.clear();
+        mCapacity = std::max(mCapacity * 2u, mPeak + mPeak / 4u);
+        mBuffer = std::make_unique<std::byte[]>(mCapacity);
+    }
+
+    mUsed = 0u;
+    mRequested = 0u;
+}
+
+std::size_t FrameArena::getCapacity() const noexcept {
+    return mCapacity;
+}
+
+std::size_t FrameArena::getPeak() const noexcept {
+    return mPeak;
+}
+
+void *FrameArena::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+    auto space = mCapacity - mUsed;
+    void *pointer = mBuffer.get() + mUsed;
+
+    mRequested += bytes;
+    mPeak = std::max(mPeak, mRequested);
+
+    if (std::align(alignment, bytes, pointer, space)) {
+        mUsed = mCapacity - space + bytes;
+        return pointer;
+    }
+
+    pointer = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    mOverflows.push_back(Overflow{pointer, bytes, alignment});
+    return pointer;
+}
+
+void FrameArena::do_deallocate(void *, std::size_t, std::size_t) noexcept {
+    // everything is released at once by reset
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
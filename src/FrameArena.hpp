@@ -0,0 +1,90 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+
+namespace nongravitar {
+    /**
+     * Linear allocator for the scratch data of a single frame: allocating is a pointer bump, deallocating does nothing
+     * and everything is released at once by `reset`.
+     *
+     * Whatever doesn't fit is taken from the heap, the buffer then grows on the next reset so that the heap is touched
+     * only until the arena has warmed up.
+     */
+    class FrameArena final : public std::pmr::memory_resource {
+    public:
+        FrameArena() = delete; // no default-constructible
+
+        explicit FrameArena(std::size_t capacity);
+
+        FrameArena(const FrameArena &) = delete; // no copy-constructible
+        FrameArena &operator=(const FrameArena &) = delete; // no copy-assignable
+
+        FrameArena(FrameArena &&) = delete; // no move-constructible
+        FrameArena &operator=(FrameArena &&) = delete; // no move-assignable
+
+        ~FrameArena() final;
+
+        /**
+         * Release everything allocated since the previous reset.
+         *
+         * @warning
+         *  Containers using the arena must not outlive the frame they were created in.
+         */
+        void reset();
+
+        [[nodiscard]] std::size_t getCapacity() const noexcept;
+
+        /**
+         * Most bytes requested during a single frame so far, including the ones that didn't fit.
+         */
+        [[nodiscard]] std::size_t getPeak() const noexcept;
+
+    private:
+        struct Overflow final {
+            void *pointer;
+            std::size_t bytes;
+            std::size_t alignment;
+        };
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) final;
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) noexcept final;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept final;
+
+        std::unique_ptr<std::byte[]> mBuffer;
+        std::size_t mCapacity;
+        std::size_t mUsed{0u};
+        std::size_t mRequested{0u};
+        std::size_t mPeak{0u};
+        std::vector<Overflow> mOverflows;
+    };
+}
@@ -0,0 +1,107 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <thread>
+#include <algorithm>
+#include <FramePacer.hpp>
+
+using namespace nongravitar;
+using namespace std::chrono_literals;
+
+// the sleep overshoot is learnt at runtime but never trusted below/above these bounds.
+constexpr auto MIN_SPIN_THRESHOLD = std::chrono::steady_clock::duration(500us);
+constexpr auto MAX_SPIN_THRESHOLD = std::chrono::steady_clock::duration(4ms);
+
+FramePacer::FramePacer(const PacingMode mode, const unsigned refreshRate) noexcept :
+        mPeriod{std::chrono::duration_cast<Clock::duration>(1s) / std::max(refreshRate, 1u)},
+        mSpinThreshold{MAX_SPIN_THRESHOLD / 2},
+        mMode{mode} {
+    restart();
+}
+
+void FramePacer::restart() noexcept {
+    mDeadline = mLastFrame = Clock::now();
+    mDeadline += mPeriod;
+}
+
+void FramePacer::wait() noexcept {
+    if (PacingMode::Precise == mMode) {
+        if (auto now = Clock::now(); now > mDeadline + mPeriod) {
+            // we are more than a whole frame late, catching up would only burst frames so resync instead.
+            mDeadline = now;
+        } else {
+            sleepUntil(mDeadline);
+        }
+
+        mDeadline += mPeriod;
+    }
+
+    track(Clock::now());
+}
+
+PacingMode FramePacer::getMode() const noexcept {
+    return mMode;
+}
+
+sf::Time FramePacer::getFramePeriod() const noexcept {
+    return sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(mPeriod).count());
+}
+
+const FramePacer::Stats &FramePacer::getStats() const noexcept {
+    return mStats;
+}
+
+void FramePacer::sleepUntil(const Clock::time_point deadline) noexcept {
+    // coarse sleep: the scheduler wakes us late by an unpredictable amount so leave some room for the spin.
+    if (const auto wakeUp = deadline - mSpinThreshold; Clock::now() < wakeUp) {
+        std::this_thread::sleep_until(wakeUp);
+
+        const auto overshoot = Clock::now() - wakeUp;
+        // decay slowly towards the observed overshoot, but react immediately to a worse one.
+        mSpinThreshold = std::clamp(std::max(mSpinThreshold - mSpinThreshold / 64, overshoot + overshoot / 4),
+                                    MIN_SPIN_THRESHOLD, MAX_SPIN_THRESHOLD);
+    }
+
+    // fine spin: burns a bit of CPU in exchange of hitting the deadline within a few microseconds.
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::track(const Clock::time_point now) noexcept {
+    const auto interval = now - mLastFrame;
+    const auto jitter = interval > mPeriod ? interval - mPeriod : mPeriod - interval;
+    const auto jitterMicros = std::chrono::duration_cast<std::chrono::microseconds>(jitter).count();
+
+    mLastFrame = now;
+    mStats.frames += 1;
+    mStats.missed += interval > mPeriod + mPeriod / 2;
+    mJitterSum += jitter.count();
+    mStats.meanJitter = sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::duration(mJitterSum / static_cast<Clock::duration::rep>(mStats.frames))).count());
+    mStats.maxJitter = std::max(mStats.maxJitter, sf::microseconds(jitterMicros));
+}
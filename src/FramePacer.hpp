@@ -0,0 +1,89 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <SFML/System.hpp>
+
+namespace nongravitar {
+    enum class PacingMode {
+        VSync = 0, // rely on the display swap only
+        Precise,   // sleep most of the frame then spin until the deadline
+    };
+
+    class FramePacer final {
+    public:
+        struct Stats final {
+            sf::Time meanJitter;
+            sf::Time maxJitter;
+            unsigned long frames{0ul};
+            unsigned long missed{0ul};
+        };
+
+        FramePacer() = delete; // no default-constructible
+
+        FramePacer(PacingMode mode, unsigned refreshRate) noexcept;
+
+        FramePacer(const FramePacer &) = delete; // no copy-constructible
+        FramePacer &operator=(const FramePacer &) = delete; // no copy-assignable
+
+        FramePacer(FramePacer &&) = delete; // no move-constructible
+        FramePacer &operator=(FramePacer &&) = delete; // no move-assignable
+
+        /**
+         * Start pacing from now on, discarding any previous deadline.
+         */
+        void restart() noexcept;
+
+        /**
+         * Block until the beginning of the next frame.
+         * This method should be called exactly once per iteration, right after the window has been displayed.
+         *
+         * In VSync mode the display swap already blocks, so this method only keeps track of the pacing jitter.
+         */
+        void wait() noexcept;
+
+        [[nodiscard]] PacingMode getMode() const noexcept;
+        [[nodiscard]] sf::Time getFramePeriod() const noexcept;
+        [[nodiscard]] const Stats &getStats() const noexcept;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void sleepUntil(Clock::time_point deadline) noexcept;
+        void track(Clock::time_point now) noexcept;
+
+        Stats mStats;
+        Clock::duration mPeriod;
+        Clock::duration mSpinThreshold;
+        Clock::time_point mDeadline;
+        Clock::time_point mLastFrame;
+        Clock::duration::rep mJitterSum{0};
+        const PacingMode mMode;
+    };
+}
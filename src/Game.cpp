@@ -25,57 +25,237 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <chrono>
+#include <iostream>
 #include <scene/TitleScreen.hpp>
 #include <scene/SolarSystem.hpp>
 #include <scene/LeaderBoard.hpp>
 #include <constants.hpp>
 #include <helpers.hpp>
+#include <allocations.hpp>
 #include <Game.hpp>
 
 using namespace nongravitar;
 using namespace nongravitar::scene;
+using namespace nongravitar::assets;
 using namespace nongravitar::constants;
 
+#ifdef NONGRAVITAR_SERIAL_SYSTEMS
+constexpr auto SERIAL_SYSTEMS = true;
+#else
+constexpr auto SERIAL_SYSTEMS = false;
+#endif
+
+std::size_t systemWorkers(const Options &options) noexcept {
+    // a single-thread run keeps the systems on the main thread as well
+    return SERIAL_SYSTEMS or not options.threadedRendering ? 0u : WorkerPool::spareWorkers(MAX_SYSTEM_WORKERS);
+}
+
+Game::Game(const Options &options) :
+        mFramePacer(options.pacingMode, options.refreshRate),
+        mRenderer(mWindow, mAssets),
+        mFrameArena(FRAME_ARENA_CAPACITY),
+        mWorkerPool(systemWorkers(options)),
+        mOptions(options) {}
+
 Game &Game::initialize() {
-    mAssets.initialize();
-    initializeWindow();
-    initializeScenes();
+    auto seed = mOptions.seed;
+
+    if (not mOptions.replayPath.empty()) {
+        mReplayPlayer = std::make_unique<ReplayPlayer>(mOptions.replayPath);
+        seed = mReplayPlayer->getSeed();
+    }
+
+    // always reported so that any run can be reproduced with --seed
+    std::clog << "seed: " << seed << std::endl;
+
+    mAssets.initialize(mOptions.isFastForward());
+
+    if (not mOptions.headless) {
+        initializeWindow();
+    }
+
+    if (mReplayPlayer) {
+        // the simulation depends on the viewport so it must be the recorded one, whatever the actual window is.
+        mViewport = mReplayPlayer->getViewport();
+        mWindow.setView(sf::View(mViewport));
+    } else if (mOptions.headless) { // there is no window to measure, an autopilot run plays on a full-hd screen
+        mViewport = sf::FloatRect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    }
+
+    if (not mOptions.recordPath.empty()) {
+        mReplayRecorder = std::make_unique<ReplayRecorder>(mOptions.recordPath, seed, mViewport, mOptions.keyframeInterval);
+    }
+
+    if (not mOptions.hashLogPath.empty()) {
+        mStateHashLog = std::make_unique<StateHashLog>(mOptions.hashLogPath);
+    }
+
+    initializeScenes(seed);
+
+    if (mReplayPlayer and 0u != mOptions.seekTick) {
+        seek(mOptions.seekTick);
+    }
+
     return *this;
 }
 
 int Game::run() {
+    using Clock = std::chrono::steady_clock;
+
+    const auto waitConsumed = PacingMode::VSync == mFramePacer.getMode();
+    const auto fastForward = mOptions.isFastForward();
+    const auto fixedStep = sf::seconds(1.0f / static_cast<float>(mOptions.refreshRate));
+    const auto firstTick = mTick;
+    const auto started = Clock::now();
+    auto reported = started;
+    auto reportedTick = mTick;
+    auto simulated = sf::Time::Zero;
+
+    if (mOptions.threadedRendering and not mOptions.headless) {
+        mRenderer.start();
+    }
+
     mClock.restart();
+    mFramePacer.restart();
+
+    while (nullSceneId != mCurrentSceneId) {
+        if (mReplayRecorder and mReplayRecorder->wantsKeyframe()) {
+            mKeyframe.clear();
+            save(mKeyframe);
+            mReplayRecorder->keyframe(mKeyframe.getBuffer());
+        }
+
+        if (0u != mOptions.tickLimit and mTick >= mOptions.tickLimit) {
+            std::clog << "tick limit reached: " << mTick << std::endl;
+            break;
+        }
+
+        auto input = Input::fromKeyboard();
+        // uncapped ticks would be a few microseconds long: a live run in fast-forward dilates time instead,
+        // the autopilot always does so that its runs only depend on the seed
+        auto elapsed = fastForward or mOptions.autopilot ? fixedStep : mClock.restart();
+
+        if (not mOptions.headless) {
+            handleEvents(input);
+        }
+
+        if (mReplayPlayer and not mReplayPlayer->next(input, elapsed)) {
+            std::clog << "replay over at tick: " << mReplayPlayer->getTick() << std::endl;
+            break;
+        }
+
+        if (mOptions.autopilot and nullSceneId != mCurrentSceneId) {
+            if (auto autopilotInput = mSceneManager.get(mCurrentSceneId).autopilot(mViewport); autopilotInput) {
+                input = *autopilotInput;
+            } else {
+                std::clog << "autopilot over at tick: " << mTick << std::endl;
+                break;
+            }
+        }
+
+        if (mReplayRecorder) {
+            mReplayRecorder->record(input, elapsed);
+        }
 
-    for (handleEvents(); nullSceneId != mCurrentSceneId; handleEvents()) {
-        mCurrentSceneId = mSceneManager.get(mCurrentSceneId).update(mWindow, mSceneManager, mAssets, mClock.restart());
-        mWindow.clear();
-        mSceneManager.get(mCurrentSceneId).render(mWindow);
-        mWindow.display();
+        step(input, elapsed);
+        mFrameArena.reset();
+
+        if (not fastForward) {
+            if (nullSceneId != mCurrentSceneId) {
+                mSceneManager.get(mCurrentSceneId).render(mRenderer.getBackBuffer());
+                mRenderer.publish(waitConsumed);
+                mFramePacer.wait();
+            }
+        } else {
+            if (not mOptions.headless and nullSceneId != mCurrentSceneId and 0u == mTick % mOptions.fastForward) {
+                mSceneManager.get(mCurrentSceneId).render(mRenderer.getBackBuffer());
+                mRenderer.publish(false);
+            }
+
+            simulated += elapsed;
+
+            if (const auto now = Clock::now(); now - reported >= std::chrono::seconds(1)) {
+                const auto seconds = std::chrono::duration<double>(now - reported).count();
+                std::clog << "tick: " << mTick << " (" << static_cast<unsigned long>((mTick - reportedTick) / seconds) << " ticks/s)" << std::endl;
+                reported = now;
+                reportedTick = mTick;
+            }
+        }
     }
 
+    mRenderer.stop();
     mWindow.close();
+
+    if (fastForward) {
+        const auto &audioManager = mAssets.getAudioManager();
+        const auto seconds = std::chrono::duration<double>(Clock::now() - started).count();
+        const auto ticks = mTick - firstTick;
+
+        std::clog << "fast-forward: " << ticks << " ticks in " << seconds << "s (" << static_cast<unsigned long>(ticks / seconds) << " ticks/s), "
+                  << simulated.asSeconds() << "s simulated (x" << simulated.asSeconds() / seconds << ")" << std::endl;
+        std::clog << "sounds (hit/shot/tractor/explosion): "
+                  << audioManager.getPlayed(SoundId::Hit) << "/" << audioManager.getPlayed(SoundId::Shot) << "/"
+                  << audioManager.getPlayed(SoundId::Tractor) << "/" << audioManager.getPlayed(SoundId::Explosion) << std::endl;
+
+        if constexpr (allocations::isTracking()) {
+            for (const auto &scope : allocations::getScopes()) {
+                if (nullptr != scope.name) {
+                    std::clog << "allocations of " << scope.name << " (per call): "
+                              << static_cast<double>(scope.counters.allocations) / scope.calls << " ("
+                              << static_cast<double>(scope.counters.bytes) / scope.calls << " bytes)" << std::endl;
+                }
+            }
+        }
+    }
+
+    helpers::debug([&]() {
+        const auto &stats = mFramePacer.getStats();
+        std::clog << "frames: " << stats.frames << " missed: " << stats.missed
+                  << " jitter (mean/max): " << stats.meanJitter.asMicroseconds() << "us/" << stats.maxJitter.asMicroseconds() << "us" << std::endl;
+    });
+
     return 0;
 }
 
 void Game::initializeWindow() {
-    mWindow.create({800, 600}, "NonGravitar", sf::Style::Fullscreen);
-    mWindow.setVerticalSyncEnabled(true);
-    mWindow.setMouseCursorVisible(false);
-    mWindow.setKeyRepeatEnabled(false);
-    mWindow.setFramerateLimit(FPS);
-    mWindow.setActive(true);
+    createWindow(sf::Style::Fullscreen);
 }
 
-void Game::initializeScenes() {
-    auto &leaderBoard = mSceneManager.emplace<LeaderBoard>().initialize(mAssets);
+void Game::initializeScenes(const helpers::Seed seed) {
+    auto &leaderBoard = mSceneManager.emplace<LeaderBoard>().initialize();
     auto &solarSystem = mSceneManager
-            .emplace<SolarSystem>(leaderBoard.getSceneId())
-            .initialize(mWindow, mSceneManager, mAssets);
+            .emplace<SolarSystem>(leaderBoard.getSceneId(), seed)
+            .initialize(mViewport, mSceneManager, mAssets);
 
+    mSolarSystemSceneId = solarSystem.getSceneId();
     mCurrentSceneId = mSceneManager.emplace<TitleScreen>(solarSystem.getSceneId(), mAssets).getSceneId();
 }
 
-void Game::handleEvents() {
+void Game::createWindow(const sf::Uint32 style) {
+    // the render thread owns the window context, so it must be stopped while the window is re-created.
+    const auto wasRendering = mRenderer.isRunning();
+    mRenderer.stop();
+
+    mWindow.create({800, 600}, "NonGravitar", style);
+    // never combine vsync with SFML's own limiter: they fight each other and the latter overshoots anyway.
+    mWindow.setVerticalSyncEnabled(PacingMode::VSync == mFramePacer.getMode());
+    mWindow.setMouseCursorVisible(false);
+    mWindow.setKeyRepeatEnabled(false);
+    mWindow.setActive(true);
+
+    if (mReplayPlayer) {
+        mWindow.setView(sf::View(mViewport));
+    } else {
+        mViewport = sf::FloatRect(mWindow.getViewport(mWindow.getView()));
+    }
+
+    if (wasRendering) {
+        mRenderer.start();
+    }
+}
+
+void Game::handleEvents(Input &input) {
     auto event = sf::Event{};
 
     while (nullSceneId != mCurrentSceneId and mWindow.pollEvent(event)) {
@@ -90,17 +270,121 @@ void Game::handleEvents() {
                     break;
 
                 case sf::Keyboard::Delete:
-                    helpers::debug([&]() { mWindow.create({800, 600}, "NonGravitar", sf::Style::None); });
+                    helpers::debug([&]() { createWindow(sf::Style::None); });
                     break;
 
                 case sf::Keyboard::F4:
-                    helpers::debug([&]() { mWindow.create({800, 600}, "NonGravitar", sf::Style::Fullscreen); });
+                    helpers::debug([&]() { createWindow(sf::Style::Fullscreen); });
                     break;
 
                 default:
-                    mCurrentSceneId = mSceneManager.get(mCurrentSceneId).onEvent(event);
+                    input.press(event.key.code);
                     break;
             }
         }
     }
 }
+
+void Game::dispatchEvents(const Input &input) {
+    auto event = sf::Event{};
+    event.type = sf::Event::KeyPressed;
+
+    for (const auto key : Input::KEYS) {
+        if (nullSceneId != mCurrentSceneId and input.wasKeyPressed(key)) {
+            event.key.code = key;
+            mCurrentSceneId = mSceneManager.get(mCurrentSceneId).onEvent(event);
+        }
+    }
+}
+
+void Game::hashScenes(const std::initializer_list<SceneId> touched) {
+    // scenes only change while they are current or through the messages of the current scene, whose recipient is
+    // the next current scene: planets are appended by the solar system and never replaced but on load
+    for (const auto sceneId : touched) {
+        if (nullSceneId != sceneId and helpers::enumValue(sceneId) < mSceneHashes.size()) {
+            auto &sceneHash = mSceneHashes[helpers::enumValue(sceneId)];
+            sceneHash.reset();
+            mSceneManager.get(sceneId).hash(sceneHash);
+        }
+    }
+
+    while (mSceneHashes.size() < mSceneManager.size()) {
+        const auto sceneId = SceneId{mSceneHashes.size()};
+        mSceneManager.get(sceneId).hash(mSceneHashes.emplace_back());
+    }
+
+    mStateHash.reset();
+    for (const auto &sceneHash : mSceneHashes) {
+        mStateHash.add(sceneHash);
+    }
+}
+
+void Game::step(const Input &input, const sf::Time elapsed) {
+    const auto previousSceneId = mCurrentSceneId;
+    dispatchEvents(input);
+    const auto updatedSceneId = mCurrentSceneId;
+
+    if (nullSceneId != mCurrentSceneId) {
+        allocations::scope("tick", [&]() {
+            mCurrentSceneId = mSceneManager.get(mCurrentSceneId).update(mViewport, mSceneManager, mAssets, mFrameArena, mWorkerPool, input, elapsed);
+        });
+    }
+
+    mTick += 1;
+
+    if (mStateHashLog) {
+        hashScenes({previousSceneId, updatedSceneId, mCurrentSceneId});
+        mStateHashLog->write(mTick, mStateHash);
+    }
+}
+
+void Game::seek(const std::uint64_t tick) {
+    if (const auto keyframe = mReplayPlayer->seek(tick); keyframe) {
+        auto archive = InputArchive(mReplayPlayer->getState(*keyframe), keyframe->size);
+        load(archive);
+    }
+
+    mTick = mReplayPlayer->getTick();
+
+    auto &audioManager = mAssets.getAudioManager();
+    const auto silent = audioManager.isSilent();
+    auto input = Input();
+    auto elapsed = sf::Time::Zero;
+
+    audioManager.setSilent(true);
+
+    while (nullSceneId != mCurrentSceneId and mReplayPlayer->getTick() < tick and mReplayPlayer->next(input, elapsed)) {
+        step(input, elapsed);
+        mFrameArena.reset();
+    }
+
+    audioManager.setSilent(silent);
+
+    std::clog << "sought tick: " << mReplayPlayer->getTick() << "/" << mReplayPlayer->getTicks() << std::endl;
+}
+
+void Game::save(OutputArchive &archive) const {
+    archive.write(static_cast<std::uint64_t>(mSceneManager.size()));
+    archive.write(mCurrentSceneId);
+
+    for (auto i = std::size_t{0}; i < mSceneManager.size(); i++) {
+        mSceneManager.get(SceneId{i}).save(archive);
+    }
+}
+
+void Game::load(InputArchive &archive) {
+    const auto scenes = archive.read<std::uint64_t>();
+    auto &solarSystem = dynamic_cast<SolarSystem &>(mSceneManager.get(mSolarSystemSceneId));
+
+    while (mSceneManager.size() < scenes) {
+        solarSystem.resetPlanets(mViewport, mSceneManager, mAssets);
+    }
+
+    mSceneManager.truncate(scenes);
+    mSceneHashes.clear(); // scenes are restored as a whole, none of the hashes so far holds
+    archive.read(mCurrentSceneId);
+
+    for (auto i = std::size_t{0}; i < mSceneManager.size(); i++) {
+        mSceneManager.get(SceneId{i}).load(archive);
+    }
+}
@@ -27,15 +27,35 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+#include <initializer_list>
 #include <SFML/Graphics.hpp>
+#include <Input.hpp>
 #include <Scene.hpp>
+#include <Archive.hpp>
+#include <StateHash.hpp>
+#include <Replay.hpp>
 #include <Assets.hpp>
+#include <Options.hpp>
+#include <Renderer.hpp>
+#include <FramePacer.hpp>
+#include <FrameArena.hpp>
+#include <WorkerPool.hpp>
 #include <SceneManager.hpp>
 
+namespace nongravitar::bench {
+    class Probe;
+}
+
 namespace nongravitar {
     class Game final {
+        friend class bench::Probe;
+
     public:
-        Game() = default; // no default-constructible
+        Game() = delete; // no default-constructible
+
+        explicit Game(const Options &options);
 
         Game(const Game &) = delete; // no copy-constructible
         Game &operator=(const Game &) = delete; // no copy-assignable
@@ -56,14 +76,57 @@ namespace nongravitar {
 
     private:
         void initializeWindow();
-        void initializeScenes();
+        void initializeScenes(helpers::Seed seed);
+
+        void createWindow(sf::Uint32 style);
+
+        /**
+         * Handle the window events, key presses relevant to the simulation are collected into the input.
+         */
+        void handleEvents(Input &input);
+
+        /**
+         * Forward the key presses of the tick to the current scene.
+         */
+        void dispatchEvents(const Input &input);
+
+        /**
+         * Rehash the scenes a tick may have changed (those that were current and those created meanwhile) and fold
+         * every scene hash into the state hash, so that a tick costs the entities of the scenes it touched only.
+         */
+        void hashScenes(std::initializer_list<SceneId> touched);
+
+        /**
+         * Advance the simulation by one tick, logging the hash of the resulting state if requested.
+         */
+        void step(const Input &input, sf::Time elapsed);
+
+        /**
+         * Bring the replay to the given tick restoring its nearest keyframe and simulating the ticks left, silently.
+         */
+        void seek(std::uint64_t tick);
 
-        void handleEvents();
+        void save(OutputArchive &archive) const;
+        void load(InputArchive &archive);
 
         sf::RenderWindow mWindow;
         SceneManager mSceneManager;
         Assets mAssets;
         sf::Clock mClock;
+        FramePacer mFramePacer;
+        Renderer mRenderer;
+        FrameArena mFrameArena;
+        WorkerPool mWorkerPool; // shared by the scenes running their systems concurrently
+        std::unique_ptr<ReplayRecorder> mReplayRecorder;
+        std::unique_ptr<ReplayPlayer> mReplayPlayer;
+        std::unique_ptr<StateHashLog> mStateHashLog;
+        StateHash mStateHash;
+        std::vector<StateHash> mSceneHashes; // scenes left untouched by a tick keep their hash
+        OutputArchive mKeyframe;
+        sf::FloatRect mViewport;
+        SceneId mSolarSystemSceneId = nullSceneId;
         SceneId mCurrentSceneId = nullSceneId;
+        std::uint64_t mTick{0u};
+        const Options mOptions;
     };
 }
@@ -0,0 +1,80 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Input.hpp>
+
+using namespace nongravitar;
+
+Input::Input(const Mask held, const Mask pressed) noexcept : mHeld(held), mPressed(pressed) {}
+
+Input Input::fromKeyboard() noexcept {
+    auto input = Input();
+
+    for (const auto key : KEYS) {
+        if (sf::Keyboard::isKeyPressed(key)) {
+            input.mHeld |= maskOf(key);
+        }
+    }
+
+    return input;
+}
+
+bool Input::press(const sf::Keyboard::Key key) noexcept {
+    mPressed |= maskOf(key);
+    return 0u != maskOf(key);
+}
+
+bool Input::hold(const sf::Keyboard::Key key) noexcept {
+    mHeld |= maskOf(key);
+    return 0u != maskOf(key);
+}
+
+bool Input::isKeyPressed(const sf::Keyboard::Key key) const noexcept {
+    return 0u != (mHeld & maskOf(key));
+}
+
+bool Input::wasKeyPressed(const sf::Keyboard::Key key) const noexcept {
+    return 0u != (mPressed & maskOf(key));
+}
+
+Input::Mask Input::getHeld() const noexcept {
+    return mHeld;
+}
+
+Input::Mask Input::getPressed() const noexcept {
+    return mPressed;
+}
+
+Input::Mask Input::maskOf(const sf::Keyboard::Key key) noexcept {
+    for (auto i = 0u; i < KEYS.size(); i++) {
+        if (key == KEYS[i]) {
+            return static_cast<Mask>(1u << i);
+        }
+    }
+
+    return 0u;
+}
@@ -0,0 +1,86 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <SFML/Window.hpp>
+
+namespace nongravitar {
+    /**
+     * The state of the keys that drive the simulation during a single tick.
+     * It is kept as a couple of bitmasks so that it can be recorded and replayed bit for bit.
+     */
+    class Input final {
+    public:
+        using Mask = std::uint8_t;
+
+        /// The keys tracked, any other key is not part of the simulation.
+        static constexpr std::array<sf::Keyboard::Key, 6> KEYS{
+                sf::Keyboard::W, sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::D,
+                sf::Keyboard::Space, sf::Keyboard::RShift,
+        };
+
+        Input() = default; // default-constructible
+
+        Input(Mask held, Mask pressed) noexcept;
+
+        /**
+         * Sample the keys currently held down on the real keyboard.
+         * Key presses can't be sampled, they have to be collected from the window events with `press`.
+         */
+        [[nodiscard]] static Input fromKeyboard() noexcept;
+
+        /**
+         * Record a key press, returns false if the key is not tracked.
+         */
+        bool press(sf::Keyboard::Key key) noexcept;
+
+        /**
+         * Hold a key down for the whole tick, returns false if the key is not tracked.
+         */
+        bool hold(sf::Keyboard::Key key) noexcept;
+
+        /// Whether the key is held down during the tick.
+        [[nodiscard]] bool isKeyPressed(sf::Keyboard::Key key) const noexcept;
+
+        /// Whether the key has been pressed since the previous tick.
+        [[nodiscard]] bool wasKeyPressed(sf::Keyboard::Key key) const noexcept;
+
+        [[nodiscard]] Mask getHeld() const noexcept;
+        [[nodiscard]] Mask getPressed() const noexcept;
+
+    private:
+        [[nodiscard]] static Mask maskOf(sf::Keyboard::Key key) noexcept;
+
+        Mask mHeld{0u};
+        Mask mPressed{0u};
+    };
+
+    static_assert(Input::KEYS.size() <= 8 * sizeof(Input::Mask));
+}
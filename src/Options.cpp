@@ -0,0 +1,142 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <limits>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <trace.hpp>
+#include <Options.hpp>
+
+using namespace nongravitar;
+
+/**
+ * @throws std::invalid_argument if the value isn't an unsigned number up to the given maximum.
+ */
+unsigned long long parseUnsigned(const char *option, const char *value, unsigned long long max = std::numeric_limits<unsigned long long>::max());
+
+Options Options::parse(const int argc, const char *const argv[]) {
+    auto options = Options();
+    auto randomDevice = helpers::RandomDevice();
+
+    options.seed = (helpers::Seed{randomDevice()} << 32u) | randomDevice();
+
+    for (auto i = 1; i < argc; i++) {
+        const auto argument = argv[i];
+        const auto value = [&]() {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument(std::string(__TRACE__ "Missing value for: ") + argument);
+            }
+            return argv[++i];
+        };
+
+        if (0 == std::strcmp(argument, "--vsync")) {
+            options.pacingMode = PacingMode::VSync;
+        } else if (0 == std::strcmp(argument, "--single-thread")) {
+            options.threadedRendering = false;
+        } else if (0 == std::strcmp(argument, "--headless")) {
+            options.headless = true;
+        } else if (0 == std::strcmp(argument, "--autopilot")) {
+            options.autopilot = true;
+        } else if (0 == std::strcmp(argument, "--record")) {
+            options.recordPath = value();
+        } else if (0 == std::strcmp(argument, "--replay")) {
+            options.replayPath = value();
+        } else if (0 == std::strcmp(argument, "--fast-forward")) {
+            options.fastForward = static_cast<unsigned>(parseUnsigned(argument, value(), std::numeric_limits<unsigned>::max()));
+            if (0u == options.fastForward) {
+                throw std::invalid_argument(trace("--fast-forward must be greater than zero, see --headless"));
+            }
+        } else if (0 == std::strcmp(argument, "--hashes")) {
+            options.hashLogPath = value();
+        } else if (0 == std::strcmp(argument, "--keyframes")) {
+            options.keyframeInterval = parseUnsigned(argument, value());
+        } else if (0 == std::strcmp(argument, "--seek")) {
+            options.seekTick = parseUnsigned(argument, value());
+        } else if (0 == std::strcmp(argument, "--ticks")) {
+            options.tickLimit = parseUnsigned(argument, value());
+        } else if (0 == std::strcmp(argument, "--seed")) {
+            options.seed = parseUnsigned(argument, value());
+        } else if (0 == std::strcmp(argument, "--fps")) {
+            options.refreshRate = static_cast<unsigned>(parseUnsigned(argument, value(), std::numeric_limits<unsigned>::max()));
+            if (0u == options.refreshRate) {
+                throw std::invalid_argument(trace("--fps must be greater than zero"));
+            }
+        } else {
+            throw std::invalid_argument(std::string(__TRACE__ "Unknown argument: ") + argument);
+        }
+    }
+
+    if (options.headless and options.replayPath.empty() and not options.autopilot) {
+        throw std::invalid_argument(trace("--headless requires an input source: --replay or --autopilot"));
+    }
+
+    if (options.autopilot and not options.replayPath.empty()) {
+        throw std::invalid_argument(trace("--autopilot and --replay are mutually exclusive"));
+    }
+
+    if (0u != options.seekTick and options.replayPath.empty()) {
+        throw std::invalid_argument(trace("--seek requires --replay"));
+    }
+
+    return options;
+}
+
+const char *Options::usage() noexcept {
+    return "Usage: nongravitar [options]\r\n"
+           "  --vsync              pace frames with the display vertical sync only\r\n"
+           "  --fps <rate>         target refresh rate of the precise frame pacer (default: 60)\r\n"
+           "  --single-thread      update and render the scenes in series on the main thread, systems included\r\n"
+           "  --seed <seed>        master seed of the simulation (default: random)\r\n"
+           "  --record <file>      record the input of every tick into a replay file\r\n"
+           "  --replay <file>      play a replay file back (its seed overrides --seed)\r\n"
+           "  --keyframes <n>      ticks between two keyframes of a recording, 0 disables them (default: 1800)\r\n"
+           "  --seek <tick>        start a replay from the given tick\r\n"
+           "  --autopilot          let a scripted bot play, its input is recorded as any other\r\n"
+           "  --ticks <n>          stop after the given number of ticks\r\n"
+           "  --headless           run without a window as fast as possible, requires --replay or --autopilot\r\n"
+           "  --fast-forward <n>   run as fast as possible rendering one tick every n\r\n"
+           "  --hashes <file>      write a hash of the gameplay state of every tick into a log\r\n";
+}
+
+bool Options::isFastForward() const noexcept {
+    return headless or 0u != fastForward;
+}
+
+unsigned long long parseUnsigned(const char *const option, const char *const value, const unsigned long long max) {
+    try {
+        auto consumed = std::size_t{0};
+        const auto result = std::stoull(value, &consumed);
+        if ('-' != value[0] and consumed == std::strlen(value) and result <= max) {
+            return result;
+        }
+    } catch (const std::logic_error &) {
+        // fallthrough
+    }
+
+    throw std::invalid_argument(std::string(__TRACE__ "Invalid value for ") + option + ": " + value);
+}
@@ -0,0 +1,65 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <helpers.hpp>
+#include <FramePacer.hpp>
+#include <constants.hpp>
+
+namespace nongravitar {
+    struct Options final {
+        /**
+         * Parse the command line arguments.
+         *
+         * @throws std::invalid_argument if an argument is unknown or malformed.
+         */
+        [[nodiscard]] static Options parse(int argc, const char *const argv[]);
+
+        [[nodiscard]] static const char *usage() noexcept;
+
+        /**
+         * Whether ticks run uncapped and silently, as fast as they can be simulated.
+         */
+        [[nodiscard]] bool isFastForward() const noexcept;
+
+        PacingMode pacingMode{PacingMode::Precise};
+        unsigned refreshRate{constants::FPS};
+        bool threadedRendering{true};
+        bool headless{false};
+        bool autopilot{false};
+        unsigned fastForward{0u};
+        helpers::Seed seed{0u};
+        std::string recordPath;
+        std::string replayPath;
+        std::string hashLogPath;
+        std::uint64_t keyframeInterval{30u * constants::FPS};
+        std::uint64_t seekTick{0u};
+        std::uint64_t tickLimit{0u};
+    };
+}
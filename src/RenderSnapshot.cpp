@@ -0,0 +1,63 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+#include <RenderSnapshot.hpp>
+
+using namespace nongravitar;
+
+bool nongravitar::operator==(const Label &a, const Label &b) noexcept {
+    return a.position == b.position and
+           a.color == b.color and
+           a.characterSize == b.characterSize and
+           a.fontId == b.fontId and
+           0 == std::strncmp(a.string.data(), b.string.data(), a.string.size());
+}
+
+bool nongravitar::operator!=(const Label &a, const Label &b) noexcept {
+    return not(a == b);
+}
+
+void RenderSnapshot::clear() noexcept {
+    mItems.clear();
+}
+
+void RenderSnapshot::draw(const sf::Sprite &sprite) {
+    mItems.emplace_back(sprite);
+}
+
+void RenderSnapshot::draw(const components::Renderable &renderable) {
+    mItems.emplace_back(renderable);
+}
+
+void RenderSnapshot::draw(const Label &label) {
+    mItems.emplace_back(label);
+}
+
+const std::vector<RenderSnapshot::Item> &RenderSnapshot::getItems() const noexcept {
+    return mItems;
+}
@@ -0,0 +1,80 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <variant>
+#include <SFML/Graphics.hpp>
+#include <components.hpp>
+#include <assets/FontsManager.hpp>
+
+namespace nongravitar {
+    /**
+     * A text line laid out by the renderer, centered on its position.
+     * Font metrics are owned by the render thread so the simulation only deals with plain data.
+     */
+    struct Label final {
+        std::array<char, 64> string{};
+        sf::Vector2f position;
+        sf::Color color{sf::Color::White};
+        unsigned characterSize{30u};
+        assets::FontId fontId{assets::FontId::Mechanical};
+    };
+
+    bool operator==(const Label &a, const Label &b) noexcept;
+    bool operator!=(const Label &a, const Label &b) noexcept;
+
+    /**
+     * An immutable (once published) copy of everything that has to be drawn in a frame.
+     * Items are drawn in the same order they have been added.
+     */
+    class RenderSnapshot final {
+    public:
+        using Item = std::variant<sf::Sprite, components::Renderable, Label>;
+
+        RenderSnapshot() = default; // default-constructible
+
+        RenderSnapshot(const RenderSnapshot &) = delete; // no copy-constructible
+        RenderSnapshot &operator=(const RenderSnapshot &) = delete; // no copy-assignable
+
+        RenderSnapshot(RenderSnapshot &&) = delete; // no move-constructible
+        RenderSnapshot &operator=(RenderSnapshot &&) = delete; // no move-assignable
+
+        void clear() noexcept;
+
+        void draw(const sf::Sprite &sprite);
+        void draw(const components::Renderable &renderable);
+        void draw(const Label &label);
+
+        [[nodiscard]] const std::vector<Item> &getItems() const noexcept;
+
+    private:
+        std::vector<Item> mItems;
+    };
+}
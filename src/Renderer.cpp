@@ -0,0 +1,178 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <helpers.hpp>
+#include <Renderer.hpp>
+
+using namespace nongravitar;
+
+constexpr auto DISC_POINTS = std::size_t{30u};
+constexpr auto RING_POINTS = std::size_t{256u};
+
+Renderer::Renderer(sf::RenderWindow &window, const Assets &assets) noexcept : mWindow(window), mAssets(assets) {}
+
+Renderer::~Renderer() {
+    stop();
+}
+
+void Renderer::start() {
+    if (not mThread.joinable()) {
+        mFresh = false;
+        mRunning = true;
+        mWindow.setActive(false);
+        mThread = std::thread(&Renderer::loop, this);
+    }
+}
+
+void Renderer::stop() noexcept {
+    if (mThread.joinable()) {
+        {
+            const auto lock = std::lock_guard(mMutex);
+            mRunning = false;
+        }
+
+        mCondition.notify_all();
+        mThread.join();
+        mWindow.setActive(true);
+    }
+}
+
+bool Renderer::isRunning() const noexcept {
+    return mThread.joinable();
+}
+
+RenderSnapshot &Renderer::getBackBuffer() noexcept {
+    return mSnapshots[mBack];
+}
+
+void Renderer::publish(const bool waitConsumed) {
+    if (not isRunning()) {
+        draw(mSnapshots[mBack]);
+        mSnapshots[mBack].clear();
+        return;
+    }
+
+    auto lock = std::unique_lock(mMutex);
+    std::swap(mBack, mReady);
+    mFresh = true;
+    mCondition.notify_all();
+
+    if (waitConsumed) {
+        mCondition.wait(lock, [this]() { return not mFresh or not mRunning; });
+    }
+
+    // the buffer we got back has already been drawn (or skipped) so we can safely recycle it.
+    mSnapshots[mBack].clear();
+}
+
+void Renderer::loop() {
+    mWindow.setActive(true);
+
+    for (auto lock = std::unique_lock(mMutex); mRunning; lock.lock()) {
+        mCondition.wait(lock, [this]() { return mFresh or not mRunning; });
+
+        if (not mRunning) {
+            break;
+        }
+
+        std::swap(mFront, mReady);
+        mFresh = false;
+        lock.unlock();
+        mCondition.notify_all();
+
+        draw(mSnapshots[mFront]);
+    }
+
+    mWindow.setActive(false);
+}
+
+void Renderer::draw(const RenderSnapshot &snapshot) {
+    auto labelIndex = std::size_t{0};
+
+    mWindow.clear();
+
+    for (const auto &item : snapshot.getItems()) {
+        std::visit([&](const auto &instance) {
+            using T = std::decay_t<decltype(instance)>;
+
+            if constexpr (std::is_same_v<T, Label>) {
+                draw(instance, labelIndex++);
+            } else if constexpr (std::is_same_v<T, components::Renderable>) {
+                draw(instance);
+            } else {
+                mWindow.draw(instance);
+            }
+        }, item);
+    }
+
+    mWindow.display();
+}
+
+void Renderer::draw(const Label &label, const std::size_t index) {
+    if (index >= mLabels.size()) {
+        mLabels.emplace_back(Label{}, sf::Text());
+        mLabels.back().first.characterSize = 0u; // force the layout on first usage
+    }
+
+    // text layout is expensive, so it is cached and redone only when the label changes.
+    auto &[cachedLabel, text] = mLabels[index];
+    if (label != cachedLabel) {
+        cachedLabel = label;
+        text.setFont(mAssets.getFontsManager().get(label.fontId));
+        text.setCharacterSize(label.characterSize);
+        text.setFillColor(label.color);
+        text.setString(label.string.data());
+        text.setPosition(label.position);
+        helpers::centerOrigin(text, text.getLocalBounds());
+    }
+
+    mWindow.draw(text);
+}
+
+void Renderer::draw(const components::Renderable &renderable) {
+    using Shape = components::Renderable::Shape;
+
+    if (Shape::Sprite == renderable.getShape()) {
+        auto sprite = mAssets.getSpriteSheetsManager().get(renderable.getSpriteSheetId()).instanceSprite(renderable.getFrameIndex());
+        helpers::centerOrigin(sprite, sprite.getLocalBounds());
+        sprite.setColor(renderable.getColor());
+        sprite.setPosition(renderable.getPosition());
+        sprite.setRotation(renderable.getRotation());
+        mWindow.draw(sprite);
+    } else {
+        // a single shape is reshaped over and over, so that its vertices are allocated just once
+        mCircle.setPointCount(Shape::Ring == renderable.getShape() ? RING_POINTS : DISC_POINTS);
+        mCircle.setRadius(renderable.getRadius());
+        helpers::centerOrigin(mCircle, mCircle.getLocalBounds());
+        mCircle.setFillColor(Shape::Disc == renderable.getShape() ? renderable.getColor() : sf::Color::Transparent);
+        mCircle.setOutlineColor(renderable.getColor());
+        mCircle.setOutlineThickness(Shape::Ring == renderable.getShape() ? 1.0f : 0.0f);
+        mCircle.setPosition(renderable.getPosition());
+        mCircle.setRotation(renderable.getRotation());
+        mWindow.draw(mCircle);
+    }
+}
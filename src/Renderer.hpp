@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <SFML/Graphics.hpp>
+#include <Assets.hpp>
+#include <RenderSnapshot.hpp>
+
+namespace nongravitar {
+    /**
+     * Draws render snapshots into the window.
+     *
+     * Snapshots are triple-buffered: the simulation fills the back buffer while the render thread draws the front one,
+     * the latest published snapshot waits in between so neither side ever waits for the other.
+     * When the render thread is not running snapshots are drawn synchronously by the publisher.
+     */
+    class Renderer final {
+    public:
+        Renderer() = delete; // no default-constructible
+
+        Renderer(sf::RenderWindow &window, const Assets &assets) noexcept;
+
+        Renderer(const Renderer &) = delete; // no copy-constructible
+        Renderer &operator=(const Renderer &) = delete; // no copy-assignable
+
+        Renderer(Renderer &&) = delete; // no move-constructible
+        Renderer &operator=(Renderer &&) = delete; // no move-assignable
+
+        ~Renderer();
+
+        /**
+         * Spawn the render thread, the window context is handed over to it.
+         */
+        void start();
+
+        /**
+         * Join the render thread, the window context is handed back to the caller.
+         */
+        void stop() noexcept;
+
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        /**
+         * The buffer reserved to the simulation, it is cleared and valid until the next call to publish.
+         */
+        [[nodiscard]] RenderSnapshot &getBackBuffer() noexcept;
+
+        /**
+         * Hand the back buffer over to the render thread.
+         * If `waitConsumed` is set the call blocks until the render thread picked the snapshot up, this keeps the
+         * simulation at most one frame ahead of a vsync-paced display.
+         */
+        void publish(bool waitConsumed);
+
+    private:
+        void loop();
+        void draw(const RenderSnapshot &snapshot);
+        void draw(const Label &label, std::size_t index);
+        void draw(const components::Renderable &renderable);
+
+        sf::RenderWindow &mWindow;
+        const Assets &mAssets;
+        std::array<RenderSnapshot, 3> mSnapshots;
+        std::vector<std::pair<Label, sf::Text>> mLabels;
+        sf::CircleShape mCircle;
+        std::size_t mBack{0u}, mReady{1u}, mFront{2u};
+        bool mFresh{false};
+        bool mRunning{false};
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::thread mThread;
+    };
+}
@@ -0,0 +1,258 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <limits>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <trace.hpp>
+#include <Replay.hpp>
+
+using namespace nongravitar;
+
+constexpr char REPLAY_MAGIC[4] = {'N', 'G', 'R', 'P'};
+constexpr std::uint8_t REPLAY_VERSION = 2u; // version 1 is the same without keyframes
+constexpr std::uint8_t REPLAY_KEYFRAME = 0xFFu; // never a valid mask of held keys
+constexpr auto REPLAY_HEADER_SIZE = sizeof(REPLAY_MAGIC) + sizeof(std::uint8_t) + sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t);
+constexpr auto REPLAY_FLUSH_TICKS = 64u; // bounds the amount of ticks lost if the game crashes
+
+static_assert(Input::KEYS.size() < 8u);
+
+void writeUnsigned(std::ofstream &stream, std::uint64_t value, std::size_t bytes);
+void writeVarint(std::ofstream &stream, std::uint64_t value);
+std::uint32_t floatBits(float value) noexcept;
+float bitsFloat(std::uint32_t bits) noexcept;
+
+/*
+ * ReplayRecorder
+ */
+
+ReplayRecorder::ReplayRecorder(const std::string &path, const helpers::Seed seed, const sf::FloatRect &viewport, const std::uint64_t keyframeInterval)
+        : mStream(path, std::ios::binary | std::ios::trunc), mKeyframeInterval(keyframeInterval) {
+    if (not mStream) {
+        throw std::runtime_error(std::string(__TRACE__ "Unable to open replay: ") + path);
+    }
+
+    mStream.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    writeUnsigned(mStream, REPLAY_VERSION, sizeof(REPLAY_VERSION));
+    writeUnsigned(mStream, seed, sizeof(seed));
+    writeUnsigned(mStream, floatBits(viewport.width), sizeof(std::uint32_t));
+    writeUnsigned(mStream, floatBits(viewport.height), sizeof(std::uint32_t));
+    mStream.flush();
+}
+
+void ReplayRecorder::record(const Input &input, const sf::Time elapsed) {
+    writeUnsigned(mStream, input.getHeld(), sizeof(Input::Mask));
+    writeUnsigned(mStream, input.getPressed(), sizeof(Input::Mask));
+    writeVarint(mStream, static_cast<std::uint64_t>(std::max(elapsed.asMicroseconds(), sf::Int64{0})));
+
+    if (0u == ++mTicks % REPLAY_FLUSH_TICKS) {
+        mStream.flush();
+    }
+}
+
+bool ReplayRecorder::wantsKeyframe() const noexcept {
+    return 0u != mKeyframeInterval and 0u != mTicks and 0u == mTicks % mKeyframeInterval;
+}
+
+void ReplayRecorder::keyframe(const std::vector<char> &state) {
+    writeUnsigned(mStream, REPLAY_KEYFRAME, sizeof(REPLAY_KEYFRAME));
+    writeVarint(mStream, mTicks);
+    writeVarint(mStream, state.size());
+    mStream.write(state.data(), static_cast<std::streamsize>(state.size()));
+    mStream.flush();
+}
+
+/*
+ * ReplayPlayer
+ */
+
+ReplayPlayer::ReplayPlayer(const std::string &path) {
+    auto stream = std::ifstream(path, std::ios::binary);
+    if (not stream) {
+        throw std::runtime_error(std::string(__TRACE__ "Unable to open replay: ") + path);
+    }
+
+    mBuffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+    if (mBuffer.size() < REPLAY_HEADER_SIZE or 0 != std::memcmp(mBuffer.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC))) {
+        throw std::runtime_error(std::string(__TRACE__ "Not a replay: ") + path);
+    }
+
+    const auto readUnsigned = [this](const std::size_t bytes) {
+        auto value = std::uint64_t{0u};
+        for (auto i = 0u; i < bytes; i++) {
+            value |= std::uint64_t{mBuffer[mCursor++]} << (8u * i);
+        }
+        return value;
+    };
+
+    mCursor = sizeof(REPLAY_MAGIC);
+    if (const auto version = readUnsigned(sizeof(REPLAY_VERSION)); 0u == version or REPLAY_VERSION < version) {
+        throw std::runtime_error(std::string(__TRACE__ "Unsupported replay version: ") + std::to_string(version));
+    }
+
+    mSeed = readUnsigned(sizeof(mSeed));
+    mViewport.width = bitsFloat(static_cast<std::uint32_t>(readUnsigned(sizeof(std::uint32_t))));
+    mViewport.height = bitsFloat(static_cast<std::uint32_t>(readUnsigned(sizeof(std::uint32_t))));
+    mTicksOffset = mCursor;
+
+    // a replay cut short by a crash is still valid up to its last complete record
+    while (mCursor < mBuffer.size()) {
+        if (REPLAY_KEYFRAME == mBuffer[mCursor]) {
+            const auto keyframe = readKeyframe();
+            if (keyframe.size > mBuffer.size() - keyframe.offset) {
+                break;
+            }
+            mKeyframes.push_back(keyframe);
+        } else if (auto micros = std::uint64_t{0u}; mCursor + 2u * sizeof(Input::Mask) < mBuffer.size()) {
+            mCursor += 2u * sizeof(Input::Mask);
+            if (not readVarint(micros)) { // cut within the elapsed time
+                break;
+            }
+            mTicks += 1;
+        } else {
+            break;
+        }
+    }
+
+    mCursor = mTicksOffset;
+}
+
+bool ReplayPlayer::next(Input &input, sf::Time &elapsed) noexcept {
+    while (mCursor < mBuffer.size() and REPLAY_KEYFRAME == mBuffer[mCursor]) {
+        (void) readKeyframe();
+    }
+
+    if (mTick >= mTicks) {
+        return false;
+    }
+
+    const auto held = mBuffer[mCursor++];
+    const auto pressed = mBuffer[mCursor++];
+    auto micros = std::uint64_t{0u};
+    (void) readVarint(micros); // complete up to the last tick counted
+
+    input = Input(held, pressed);
+    elapsed = sf::microseconds(static_cast<sf::Int64>(micros));
+    mTick += 1;
+    return true;
+}
+
+helpers::Seed ReplayPlayer::getSeed() const noexcept {
+    return mSeed;
+}
+
+const sf::FloatRect &ReplayPlayer::getViewport() const noexcept {
+    return mViewport;
+}
+
+const ReplayPlayer::Keyframe *ReplayPlayer::seek(const std::uint64_t tick) noexcept {
+    const auto byTick = [](const std::uint64_t value, const Keyframe &keyframe) { return value < keyframe.tick; };
+
+    if (const auto it = std::upper_bound(mKeyframes.cbegin(), mKeyframes.cend(), tick, byTick); mKeyframes.cbegin() != it) {
+        const auto &keyframe = *std::prev(it);
+        mCursor = keyframe.offset + keyframe.size;
+        mTick = keyframe.tick;
+        return &keyframe;
+    }
+
+    mCursor = mTicksOffset;
+    mTick = 0u;
+    return nullptr;
+}
+
+const char *ReplayPlayer::getState(const Keyframe &keyframe) const noexcept {
+    return reinterpret_cast<const char *>(mBuffer.data() + keyframe.offset);
+}
+
+std::uint64_t ReplayPlayer::getTick() const noexcept {
+    return mTick;
+}
+
+std::uint64_t ReplayPlayer::getTicks() const noexcept {
+    return mTicks;
+}
+
+bool ReplayPlayer::readVarint(std::uint64_t &value) noexcept {
+    value = 0u;
+
+    for (auto shift = 0u; mCursor < mBuffer.size() and shift < 64u; shift += 7u) {
+        const auto byte = mBuffer[mCursor++];
+        value |= std::uint64_t{byte & 0x7fu} << shift;
+        if (0u == (byte & 0x80u)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ReplayPlayer::Keyframe ReplayPlayer::readKeyframe() noexcept {
+    mCursor += sizeof(REPLAY_KEYFRAME);
+
+    auto keyframe = Keyframe{};
+    auto size = std::uint64_t{0u};
+    const auto isComplete = readVarint(keyframe.tick) and readVarint(size);
+
+    keyframe.size = isComplete ? static_cast<std::size_t>(size) : std::numeric_limits<std::size_t>::max();
+    keyframe.offset = mCursor;
+
+    mCursor = keyframe.size > mBuffer.size() - mCursor ? mBuffer.size() : mCursor + keyframe.size;
+    return keyframe;
+}
+
+/*
+ * Helpers
+ */
+
+void writeUnsigned(std::ofstream &stream, const std::uint64_t value, const std::size_t bytes) {
+    for (auto i = 0u; i < bytes; i++) {
+        stream.put(static_cast<char>((value >> (8u * i)) & 0xffu));
+    }
+}
+
+void writeVarint(std::ofstream &stream, std::uint64_t value) {
+    do {
+        const auto byte = static_cast<std::uint8_t>(value & 0x7fu);
+        value >>= 7u;
+        stream.put(static_cast<char>(0u == value ? byte : byte | 0x80u));
+    } while (0u != value);
+}
+
+std::uint32_t floatBits(const float value) noexcept {
+    auto bits = std::uint32_t{0u};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(const std::uint32_t bits) noexcept {
+    auto value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
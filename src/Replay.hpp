@@ -0,0 +1,149 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <SFML/Graphics.hpp>
+#include <Input.hpp>
+#include <helpers.hpp>
+
+namespace nongravitar {
+    /**
+     * Records the input of every tick, along with everything else the simulation depends on (seed, viewport and
+     * elapsed time), into a compact binary file.
+     *
+     * Every N ticks a keyframe, the whole state of the game, is interleaved with the ticks so that a replay
+     * can be sought without simulating it from the start.
+     *
+     * Layout (little-endian):
+     *  header:   "NGRP" | version: u8 | seed: u64 | viewport width: f32 | viewport height: f32
+     *  tick:     held keys: u8 | pressed keys: u8 | elapsed microseconds: LEB128 varint
+     *  keyframe: 0xFF | tick: LEB128 varint | size: LEB128 varint | state: u8[size]
+     *
+     * @warning
+     *  Keyframes have the native layout of the build that recorded them, see OutputArchive.
+     */
+    class ReplayRecorder final {
+    public:
+        ReplayRecorder() = delete; // no default-constructible
+
+        /**
+         * @param keyframeInterval ticks between two keyframes, zero disables them.
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        ReplayRecorder(const std::string &path, helpers::Seed seed, const sf::FloatRect &viewport, std::uint64_t keyframeInterval);
+
+        ReplayRecorder(const ReplayRecorder &) = delete; // no copy-constructible
+        ReplayRecorder &operator=(const ReplayRecorder &) = delete; // no copy-assignable
+
+        ReplayRecorder(ReplayRecorder &&) = delete; // no move-constructible
+        ReplayRecorder &operator=(ReplayRecorder &&) = delete; // no move-assignable
+
+        void record(const Input &input, sf::Time elapsed);
+
+        /**
+         * Whether the state of the game before the next tick should be recorded as a keyframe.
+         */
+        [[nodiscard]] bool wantsKeyframe() const noexcept;
+
+        void keyframe(const std::vector<char> &state);
+
+    private:
+        std::ofstream mStream;
+        std::uint64_t mTicks{0u};
+        const std::uint64_t mKeyframeInterval;
+    };
+
+    class ReplayPlayer final {
+    public:
+        struct Keyframe final {
+            std::uint64_t tick;
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        ReplayPlayer() = delete; // no default-constructible
+
+        /**
+         * Load the whole replay into memory, indexing its keyframes.
+         *
+         * @throws std::runtime_error if the file cannot be read or it is not a valid replay.
+         */
+        explicit ReplayPlayer(const std::string &path);
+
+        ReplayPlayer(const ReplayPlayer &) = delete; // no copy-constructible
+        ReplayPlayer &operator=(const ReplayPlayer &) = delete; // no copy-assignable
+
+        ReplayPlayer(ReplayPlayer &&) = delete; // no move-constructible
+        ReplayPlayer &operator=(ReplayPlayer &&) = delete; // no move-assignable
+
+        /**
+         * Read the next tick, returns false once the replay is over.
+         */
+        [[nodiscard]] bool next(Input &input, sf::Time &elapsed) noexcept;
+
+        /**
+         * Move right after the latest keyframe at or before the tick, returns nullptr and moves to the first tick if
+         * there is none. Ticks up to the requested one are then meant to be simulated from there.
+         */
+        [[nodiscard]] const Keyframe *seek(std::uint64_t tick) noexcept;
+
+        /**
+         * The state recorded by a keyframe of this replay, it lives as long as the player.
+         */
+        [[nodiscard]] const char *getState(const Keyframe &keyframe) const noexcept;
+
+        [[nodiscard]] helpers::Seed getSeed() const noexcept;
+        [[nodiscard]] const sf::FloatRect &getViewport() const noexcept;
+        [[nodiscard]] std::uint64_t getTick() const noexcept;
+        [[nodiscard]] std::uint64_t getTicks() const noexcept;
+
+    private:
+        /**
+         * Read a varint into the value, returns false if the buffer ends before its last byte.
+         */
+        [[nodiscard]] bool readVarint(std::uint64_t &value) noexcept;
+
+        /**
+         * Read a keyframe positioning the cursor right after it, a truncated one ends at the end of the buffer.
+         */
+        [[nodiscard]] Keyframe readKeyframe() noexcept;
+
+        std::vector<std::uint8_t> mBuffer;
+        std::vector<Keyframe> mKeyframes;
+        std::size_t mTicksOffset{0u};
+        std::size_t mCursor{0u};
+        std::uint64_t mTicks{0u};
+        std::uint64_t mTick{0u};
+        helpers::Seed mSeed{0u};
+        sf::FloatRect mViewport;
+    };
+}
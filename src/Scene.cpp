@@ -33,10 +33,20 @@ SceneId Scene::onEvent(const sf::Event &) noexcept {
     return getSceneId();
 }
 
-SceneId Scene::update(const sf::RenderWindow &, SceneManager &, Assets &, sf::Time) noexcept {
+SceneId Scene::update(const sf::FloatRect &, SceneManager &, Assets &, FrameArena &, WorkerPool &, const Input &, sf::Time) noexcept {
     return getSceneId();
 }
 
+void Scene::save(OutputArchive &) const {}
+
+void Scene::load(InputArchive &) {}
+
+void Scene::hash(StateHash &) const noexcept {}
+
+std::optional<Input> Scene::autopilot(const sf::FloatRect &) const noexcept {
+    return std::nullopt;
+}
+
 SceneId Scene::getSceneId() const noexcept {
     return mSceneId;
 }
@@ -28,12 +28,20 @@
 #pragma once
 
 #include <limits>
+#include <optional>
 #include <type_traits>
 #include <SFML/Graphics.hpp>
+#include <Input.hpp>
 #include <Assets.hpp>
+#include <FrameArena.hpp>
+#include <WorkerPool.hpp>
 
 namespace nongravitar {
     class SceneManager;
+    class StateHash;
+    class InputArchive;
+    class OutputArchive;
+    class RenderSnapshot;
 
     enum class SceneId : std::size_t {};
     constexpr auto nullSceneId = SceneId{std::numeric_limits<std::underlying_type<SceneId>::type>::max()};
@@ -52,13 +60,34 @@ namespace nongravitar {
          * Update the logic of the scene returning a new scene if needed.
          * This method is called exactly once per iteration.
          */
-        [[nodiscard]] virtual SceneId update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept;
+        [[nodiscard]] virtual SceneId update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept;
 
         /**
-         * Render the scene.
+         * Render the scene into a snapshot that is going to be drawn, possibly on another thread.
          * This method is called exactly once per iteration.
          */
-        virtual void render(sf::RenderTarget &window) const noexcept = 0;
+        virtual void render(RenderSnapshot &snapshot) const noexcept = 0;
+
+        /**
+         * Dump the state of the scene that the simulation depends on, scenes without such a state write nothing.
+         */
+        virtual void save(OutputArchive &archive) const;
+
+        /**
+         * Restore a state previously dumped by this very scene.
+         */
+        virtual void load(InputArchive &archive);
+
+        /**
+         * Add the gameplay state of the scene to the hash, scenes without such a state add nothing.
+         */
+        virtual void hash(StateHash &hash) const noexcept;
+
+        /**
+         * Play the next tick on behalf of the user, returns nothing once there is nothing left to play.
+         * The input depends on the state of the scene only, so that autopilot runs are repeatable.
+         */
+        [[nodiscard]] virtual std::optional<Input> autopilot(const sf::FloatRect &viewport) const noexcept;
 
         [[nodiscard]] SceneId getSceneId() const noexcept;
 
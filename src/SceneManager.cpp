@@ -33,3 +33,17 @@ using namespace nongravitar;
 Scene &SceneManager::get(SceneId id) {
     return *mScenes.at(helpers::enumValue(id));
 }
+
+const Scene &SceneManager::get(SceneId id) const {
+    return *mScenes.at(helpers::enumValue(id));
+}
+
+std::size_t SceneManager::size() const noexcept {
+    return mScenes.size();
+}
+
+void SceneManager::truncate(const std::size_t size) {
+    if (size < mScenes.size()) {
+        mScenes.resize(size);
+    }
+}
@@ -55,6 +55,14 @@ namespace nongravitar {
         }
 
         Scene &get(SceneId id);
+        const Scene &get(SceneId id) const;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * Destroy the most recent scenes so that only the first `size` ones are left.
+         */
+        void truncate(std::size_t size);
 
     private:
         std::vector<std::unique_ptr<Scene>> mScenes;
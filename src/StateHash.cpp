@@ -0,0 +1,146 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <trace.hpp>
+#include <helpers.hpp>
+#include <components.hpp>
+#include <StateHash.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::components;
+
+/*
+ * StateHash
+ */
+
+void StateHash::reset() noexcept {
+    mValues.fill(0u);
+}
+
+void StateHash::add(const SceneId sceneId, const entt::registry &registry) noexcept {
+    const auto scene = static_cast<std::uint32_t>(helpers::enumValue(sceneId));
+    const auto entity = [](const entt::entity id) { return static_cast<std::uint32_t>(entt::to_integer(id)); };
+
+    for (auto i = std::size_t{0}; i < mValues.size(); i++) {
+        mix(Component(i), scene);
+    }
+
+    registry.view<const Renderable>().each([&](const auto id, const auto &renderable) {
+        mix(Component::Position, entity(id));
+        mix(Component::Position, renderable.getPosition().x);
+        mix(Component::Position, renderable.getPosition().y);
+    });
+
+    registry.view<const Velocity>().each([&](const auto id, const auto &velocity) {
+        mix(Component::Velocity, entity(id));
+        mix(Component::Velocity, velocity.value.x);
+        mix(Component::Velocity, velocity.value.y);
+    });
+
+    registry.view<const Health>().each([&](const auto id, const auto &health) {
+        mix(Component::Health, entity(id));
+        mix(Component::Health, static_cast<std::uint32_t>(health.getValue()));
+    });
+
+    registry.view<const Energy>().each([&](const auto id, const auto &energy) {
+        mix(Component::Energy, entity(id));
+        mix(Component::Energy, energy.getValue());
+    });
+
+    registry.view<const Score>().each([&](const auto id, const auto &score) {
+        mix(Component::Score, entity(id));
+        mix(Component::Score, score.value);
+    });
+
+    registry.view<const ReloadTime>().each([&](const auto id, const auto &reloadTime) {
+        mix(Component::ReloadTime, entity(id));
+        mix(Component::ReloadTime, reloadTime.getElapsed());
+    });
+}
+
+void StateHash::add(const TimerQueue &timerQueue) noexcept {
+    const auto microseconds = [](const sf::Time time) { return static_cast<std::uint32_t>(time.asMicroseconds()); };
+
+    mix(Component::ReloadTime, microseconds(timerQueue.getNow()));
+    for (const auto &timer : timerQueue.getTimers()) {
+        mix(Component::ReloadTime, static_cast<std::uint32_t>(entt::to_integer(timer.entity)));
+        mix(Component::ReloadTime, microseconds(timer.due));
+    }
+}
+
+void StateHash::add(const StateHash &sceneHash) noexcept {
+    for (auto i = std::size_t{0}; i < mValues.size(); i++) {
+        mix(Component(i), static_cast<std::uint32_t>(sceneHash.mValues[i]));
+        mix(Component(i), static_cast<std::uint32_t>(sceneHash.mValues[i] >> 32u));
+    }
+}
+
+const StateHash::Values &StateHash::getValues() const noexcept {
+    return mValues;
+}
+
+void StateHash::mix(const Component component, const std::uint32_t word) noexcept {
+    auto &value = mValues[helpers::enumValue(component)];
+    value = (value ^ word) * 0x100000001B3u; // FNV-1a, a word at a time
+    value ^= value >> 29u;
+}
+
+void StateHash::mix(const Component component, const float value) noexcept {
+    auto bits = std::uint32_t{0u};
+    std::memcpy(&bits, &value, sizeof(bits));
+    mix(component, bits);
+}
+
+/*
+ * StateHashLog
+ */
+
+StateHashLog::StateHashLog(const std::string &path) : mStream(path, std::ios::trunc) {
+    if (not mStream) {
+        throw std::runtime_error(std::string(__TRACE__ "Unable to open hash log: ") + path);
+    }
+
+    mStream << "tick";
+    for (const auto name : StateHash::NAMES) {
+        mStream << ' ' << name;
+    }
+    mStream << '\n';
+}
+
+void StateHashLog::write(const std::uint64_t tick, const StateHash &hash) {
+    char buffer[24];
+
+    mStream << tick;
+    for (const auto value : hash.getValues()) {
+        std::snprintf(buffer, sizeof(buffer), " %016llx", static_cast<unsigned long long>(value));
+        mStream << buffer;
+    }
+    mStream << '\n';
+}
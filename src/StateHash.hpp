@@ -0,0 +1,113 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <entt/entt.hpp>
+#include <Scene.hpp>
+#include <TimerQueue.hpp>
+
+namespace nongravitar {
+    /**
+     * A fingerprint of the gameplay state of the scenes, one hash per component so that a divergence between two
+     * runs can be traced back to the component that caused it.
+     *
+     * Components are hashed in pool order along with the entity they belong to, so a different iteration order
+     * counts as a divergence too.
+     */
+    class StateHash final {
+    public:
+        enum class Component : std::size_t {
+            Position = 0,
+            Velocity,
+            Health,
+            Energy,
+            Score,
+            ReloadTime,
+        };
+
+        static constexpr std::array<const char *, 6> NAMES{
+                "position", "velocity", "health", "energy", "score", "reload-time",
+        };
+
+        using Values = std::array<std::uint64_t, NAMES.size()>;
+
+        StateHash() = default; // default-constructible
+
+        void reset() noexcept;
+
+        void add(SceneId sceneId, const entt::registry &registry) noexcept;
+
+        /**
+         * Reload timers are part of the reload-time hash, in heap order.
+         */
+        void add(const TimerQueue &timerQueue) noexcept;
+
+        /**
+         * Fold the hash of a scene into the one of the whole game, component by component.
+         */
+        void add(const StateHash &sceneHash) noexcept;
+
+        [[nodiscard]] const Values &getValues() const noexcept;
+
+    private:
+        void mix(Component component, std::uint32_t word) noexcept;
+        void mix(Component component, float value) noexcept;
+
+        Values mValues{};
+    };
+
+    /**
+     * A side log of the state hashes, one line per tick:
+     *  tick position velocity health energy score reload-time
+     * the first line names the columns, hashes are written as hex.
+     */
+    class StateHashLog final {
+    public:
+        StateHashLog() = delete; // no default-constructible
+
+        /**
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        explicit StateHashLog(const std::string &path);
+
+        StateHashLog(const StateHashLog &) = delete; // no copy-constructible
+        StateHashLog &operator=(const StateHashLog &) = delete; // no copy-assignable
+
+        StateHashLog(StateHashLog &&) = delete; // no move-constructible
+        StateHashLog &operator=(StateHashLog &&) = delete; // no move-assignable
+
+        void write(std::uint64_t tick, const StateHash &hash);
+
+    private:
+        std::ofstream mStream;
+    };
+}
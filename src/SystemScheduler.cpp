@@ -0,0 +1,124 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <allocations.hpp>
+#include <SystemScheduler.hpp>
+
+using namespace nongravitar;
+
+// the system running on this thread, the one accesses are checked against
+thread_local const SystemScheduler::System *currentSystem = nullptr;
+
+bool conflict(const SystemScheduler::System &lhs, const SystemScheduler::System &rhs) noexcept {
+    return (lhs.writes & (rhs.reads | rhs.writes)).any() or (rhs.writes & lhs.reads).any();
+}
+
+SystemScheduler::SystemScheduler(std::vector<System> systems) :
+        mSystems(std::move(systems)) {
+
+    assert(mSystems.size() <= WorkerPool::MAX_TASKS);
+    auto waves = std::vector<std::size_t>(mSystems.size(), 0u);
+
+    for (auto i = std::size_t{0}; i < mSystems.size(); i++) {
+        for (auto j = std::size_t{0}; j < i; j++) {
+            if (conflict(mSystems[i], mSystems[j])) {
+                waves[i] = std::max(waves[i], waves[j] + 1u);
+            }
+        }
+    }
+
+    const auto count = mSystems.empty() ? std::size_t{0} : *std::max_element(waves.begin(), waves.end()) + 1u;
+    for (auto wave = std::size_t{0}; wave < count; wave++) {
+        for (auto i = std::size_t{0}; i < mSystems.size(); i++) {
+            if (wave == waves[i]) {
+                mOrder.push_back(i);
+            }
+        }
+
+        mWaveEnds.push_back(mOrder.size());
+    }
+}
+
+std::size_t SystemScheduler::getWaves() const noexcept {
+    return mWaveEnds.size();
+}
+
+std::size_t SystemScheduler::nextResourceId() noexcept {
+    static auto next = std::atomic<std::size_t>{0u};
+    const auto id = next++;
+    assert(id < Access().size());
+    return id;
+}
+
+void SystemScheduler::check(const Access &reads, const Access &writes) noexcept {
+    if (currentSystem) {
+        const auto undeclaredReads = reads & ~(currentSystem->reads | currentSystem->writes);
+        const auto undeclaredWrites = writes & ~currentSystem->writes;
+
+        if (undeclaredReads.any() or undeclaredWrites.any()) {
+            std::cerr << currentSystem->name << " accesses undeclared resources, reads " << undeclaredReads
+                      << " writes " << undeclaredWrites << std::endl;
+            std::abort();
+        }
+    }
+}
+
+void SystemScheduler::runTask(void *task) {
+    const auto &[scheduler, index, invoke, system] = *static_cast<const Task *>(task);
+
+    currentSystem = &scheduler->mSystems[index];
+    allocations::scope(currentSystem->name, [&]() { invoke(system); });
+    currentSystem = nullptr;
+}
+
+void SystemScheduler::run(WorkerPool &workerPool, const Task *const tasks, const std::size_t size) const {
+    assert(size == mSystems.size());
+
+    if (0u == workerPool.getWorkers()) {
+        for (auto i = std::size_t{0}; i < size; i++) {
+            runTask(const_cast<Task *>(tasks + i));
+        }
+        return;
+    }
+
+    auto batch = std::array<WorkerPool::Task, WorkerPool::MAX_TASKS>();
+    auto begin = std::size_t{0};
+
+    for (const auto end : mWaveEnds) {
+        for (auto i = begin; i < end; i++) {
+            batch[i - begin] = WorkerPool::Task{&runTask, const_cast<Task *>(tasks + mOrder[i])};
+        }
+
+        workerPool.run(batch.data(), end - begin);
+        begin = end;
+    }
+}
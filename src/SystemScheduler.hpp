@@ -0,0 +1,134 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <WorkerPool.hpp>
+
+namespace nongravitar {
+    /**
+     * Runs the systems of a scene once per tick, every system declaring what it reads and what it writes.
+     *
+     * Two systems conflict when one of them writes something the other one reads or writes: conflicting systems run
+     * in the order they were declared, the others may run concurrently. Systems are laid out in waves, each one goes
+     * in the wave after the last wave holding a system it conflicts with; waves run one after the other and the
+     * systems of a wave are handed to the worker pool together. The outcome is therefore the one of running the
+     * systems serially in declaration order, which is what happens with a pool without workers.
+     *
+     * Anything shared by systems that isn't a component (the entities themselves, audio, random engines, ...) has to
+     * be declared too, as a type of its own. A scheduler holds no state of a tick, scenes of the same kind share one.
+     */
+    class SystemScheduler final {
+    public:
+        using Access = std::bitset<64>;
+
+        struct System final {
+            const char *name; // a literal, it's the allocations scope of the system
+            Access reads;
+            Access writes;
+        };
+
+        template<typename ...Resources>
+        [[nodiscard]] static Access access() noexcept {
+            auto access = Access();
+            (access.set(resourceId<std::remove_const_t<Resources>>()), ...);
+            return access;
+        }
+
+        SystemScheduler() = delete; // no default-constructible
+
+        explicit SystemScheduler(std::vector<System> systems);
+
+        SystemScheduler(const SystemScheduler &) = delete; // no copy-constructible
+        SystemScheduler &operator=(const SystemScheduler &) = delete; // no copy-assignable
+
+        SystemScheduler(SystemScheduler &&) = delete; // no move-constructible
+        SystemScheduler &operator=(SystemScheduler &&) = delete; // no move-assignable
+
+        /**
+         * Run a tick, the function objects are the systems in declaration order.
+         *
+         * @warning
+         *  Function objects must not throw, they may be invoked from a thread other than the calling one.
+         */
+        template<typename ...F>
+        void run(WorkerPool &workerPool, F &&... systems) const {
+            static_assert(sizeof...(F) <= WorkerPool::MAX_TASKS);
+            auto index = std::size_t{0};
+            const auto tasks = std::array<Task, sizeof...(F)>{
+                    Task{this, index++, &invoke<std::remove_reference_t<F>>, const_cast<void *>(static_cast<const void *>(&systems))}...
+            };
+
+            run(workerPool, tasks.data(), tasks.size());
+        }
+
+        /**
+         * Abort on debug builds if the system running on the calling thread didn't declare the given accesses, a
+         * write implying a read. Anything goes outside of scheduled systems.
+         */
+        static void check(const Access &reads, const Access &writes) noexcept;
+
+        /**
+         * Number of waves a tick is split into, as many as the systems when they all conflict.
+         */
+        [[nodiscard]] std::size_t getWaves() const noexcept;
+
+    private:
+        struct Task final {
+            const SystemScheduler *scheduler;
+            std::size_t index;
+            void (*invoke)(void *);
+            void *system;
+        };
+
+        template<typename Resource>
+        [[nodiscard]] static std::size_t resourceId() noexcept {
+            static const auto id = nextResourceId();
+            return id;
+        }
+
+        [[nodiscard]] static std::size_t nextResourceId() noexcept;
+
+        template<typename F>
+        static void invoke(void *system) {
+            (*static_cast<F *>(system))();
+        }
+
+        static void runTask(void *task);
+
+        void run(WorkerPool &workerPool, const Task *tasks, std::size_t size) const;
+
+        std::vector<System> mSystems;
+        std::vector<std::size_t> mOrder; // systems wave by wave, declaration order within a wave
+        std::vector<std::size_t> mWaveEnds; // one past the last system of each wave in mOrder
+    };
+}
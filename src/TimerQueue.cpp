@@ -0,0 +1,81 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <utility>
+#include <algorithm>
+#include <TimerQueue.hpp>
+
+using namespace nongravitar;
+
+/*
+ * The ordering of the heap: std::*_heap keep the greatest element on top, the soonest timer is the greatest.
+ */
+bool isLater(const TimerQueue::Timer &lhs, const TimerQueue::Timer &rhs) noexcept {
+    return lhs.due != rhs.due ? lhs.due > rhs.due : lhs.entity > rhs.entity;
+}
+
+void TimerQueue::advance(const sf::Time elapsed) noexcept {
+    mNow += elapsed;
+}
+
+void TimerQueue::schedule(const entt::entity entity, const sf::Time delay) {
+    if (mExpiring) {
+        mRescheduled.push_back(Timer{mNow + delay, entity});
+    } else {
+        mTimers.push_back(Timer{mNow + delay, entity});
+        std::push_heap(mTimers.begin(), mTimers.end(), isLater);
+    }
+}
+
+void TimerQueue::assign(const sf::Time now, std::vector<Timer> timers) {
+    mNow = now;
+    mTimers = std::move(timers);
+}
+
+sf::Time TimerQueue::getNow() const noexcept {
+    return mNow;
+}
+
+const std::vector<TimerQueue::Timer> &TimerQueue::getTimers() const noexcept {
+    return mTimers;
+}
+
+void TimerQueue::pushRescheduled() {
+    for (const auto &timer : mRescheduled) {
+        mTimers.push_back(timer);
+        std::push_heap(mTimers.begin(), mTimers.end(), isLater);
+    }
+
+    mRescheduled.clear();
+}
+
+entt::entity TimerQueue::pop() {
+    std::pop_heap(mTimers.begin(), mTimers.end(), isLater);
+    const auto entity = mTimers.back().entity;
+    mTimers.pop_back();
+    return entity;
+}
@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <entt/entt.hpp>
+#include <SFML/System.hpp>
+
+namespace nongravitar {
+    /**
+     * Entities waiting for a point in time of a scene clock, kept in a min-heap with the soonest on top.
+     *
+     * The clock only moves when advanced, so a frame with nothing due costs a look at the top of the heap and a frame
+     * with something due costs a pop per due entity, no matter how many entities are waiting. Ties are broken by
+     * entity, hence the order entities expire in depends on the sequence of operations only.
+     */
+    class TimerQueue final {
+    public:
+        struct Timer final {
+            sf::Time due;
+            entt::entity entity;
+        };
+
+        TimerQueue() = default; // default-constructible
+
+        TimerQueue(const TimerQueue &) = delete; // no copy-constructible
+        TimerQueue &operator=(const TimerQueue &) = delete; // no copy-assignable
+
+        TimerQueue(TimerQueue &&) = delete; // no move-constructible
+        TimerQueue &operator=(TimerQueue &&) = delete; // no move-assignable
+
+        void advance(sf::Time elapsed) noexcept;
+
+        /**
+         * The entity expires once the clock has moved forward by delay, a delay of zero expires on the next expire.
+         */
+        void schedule(entt::entity entity, sf::Time delay);
+
+        /**
+         * Pops the timers due when the call begins, soonest first, invoking f with their entity.
+         *
+         * f may schedule entities again: they join the queue once every due timer has been visited, so whatever their
+         * delay (zero included) they expire on a later call.
+         *
+         * @warning
+         *  Entities are not tracked once scheduled: f is handed the destroyed ones too and should check them.
+         */
+        template<typename F>
+        void expire(F &&f) {
+            mExpiring = true;
+
+            while (not mTimers.empty() and mTimers.front().due <= mNow) {
+                const auto entity = pop();
+                f(entity);
+            }
+
+            mExpiring = false;
+            pushRescheduled();
+        }
+
+        /**
+         * Replace the clock and the timers, the latter in heap order as returned by getTimers.
+         */
+        void assign(sf::Time now, std::vector<Timer> timers);
+
+        [[nodiscard]] sf::Time getNow() const noexcept;
+        [[nodiscard]] const std::vector<Timer> &getTimers() const noexcept;
+
+    private:
+        entt::entity pop();
+        void pushRescheduled();
+
+        sf::Time mNow;
+        std::vector<Timer> mTimers;
+        std::vector<Timer> mRescheduled; // scheduled from within expire, kept apart until it's over
+        bool mExpiring{false};
+    };
+}
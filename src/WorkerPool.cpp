@@ -0,0 +1,151 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cassert>
+#include <algorithm>
+#include <allocations.hpp>
+#include <WorkerPool.hpp>
+
+using namespace nongravitar;
+
+WorkerPool::WorkerPool(const std::size_t workers) :
+        mWorkers{allocations::isTracking() ? 0u : workers},
+        mQueues{std::make_unique<Queue[]>(mWorkers + 1u)} {
+
+    for (auto queue = std::size_t{1}; queue <= mWorkers; queue++) {
+        mThreads.emplace_back(&WorkerPool::loop, this, queue);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        const auto lock = std::lock_guard(mMutex);
+        mStopping = true;
+    }
+
+    mWake.notify_all();
+    for (auto &thread : mThreads) {
+        thread.join();
+    }
+}
+
+std::size_t WorkerPool::spareWorkers(const std::size_t max) noexcept {
+    // zero when the hardware concurrency is unknown
+    const auto threads = std::size_t{std::thread::hardware_concurrency()};
+    return std::min(threads > 1u ? threads - 1u : 0u, max);
+}
+
+void WorkerPool::run(const Task *const tasks, const std::size_t size) {
+    assert(size <= MAX_TASKS);
+
+    if (0u == mWorkers or size < 2u) {
+        for (auto task = std::size_t{0}; task < size; task++) {
+            tasks[task].invoke(tasks[task].data);
+        }
+        return;
+    }
+
+    // the previous batch is over, nobody can be taking from the queues while they are dealt
+    mTasks = tasks;
+    mPending = size;
+
+    for (auto queue = std::size_t{0}; queue <= mWorkers; queue++) {
+        const auto lock = std::lock_guard(mQueues[queue].mutex);
+        mQueues[queue].front = mQueues[queue].back = 0u;
+    }
+
+    for (auto task = std::size_t{0}; task < size; task++) {
+        auto &queue = mQueues[task % (mWorkers + 1u)];
+        const auto lock = std::lock_guard(queue.mutex);
+        queue.tasks[queue.back++] = task;
+    }
+
+    {
+        const auto lock = std::lock_guard(mMutex);
+        mBatch++;
+    }
+
+    mWake.notify_all();
+    work(0u);
+
+    auto lock = std::unique_lock(mMutex);
+    mDone.wait(lock, [this]() { return 0u == mPending; });
+}
+
+std::size_t WorkerPool::getWorkers() const noexcept {
+    return mWorkers;
+}
+
+bool WorkerPool::take(const std::size_t queue, std::size_t &task) noexcept {
+    {
+        auto &own = mQueues[queue];
+        const auto lock = std::lock_guard(own.mutex);
+        if (own.front < own.back) {
+            task = own.tasks[own.front++];
+            return true;
+        }
+    }
+
+    for (auto offset = std::size_t{1}; offset <= mWorkers; offset++) {
+        auto &other = mQueues[(queue + offset) % (mWorkers + 1u)];
+        const auto lock = std::lock_guard(other.mutex);
+        if (other.front < other.back) {
+            task = other.tasks[--other.back];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkerPool::work(const std::size_t queue) noexcept {
+    for (auto task = std::size_t{0}; take(queue, task);) {
+        mTasks[task].invoke(mTasks[task].data);
+
+        if (1u == mPending.fetch_sub(1u)) {
+            const auto lock = std::lock_guard(mMutex);
+            mDone.notify_all();
+        }
+    }
+}
+
+void WorkerPool::loop(const std::size_t queue) {
+    for (auto batch = std::uint64_t{0};;) {
+        {
+            auto lock = std::unique_lock(mMutex);
+            mWake.wait(lock, [&]() { return mStopping or batch != mBatch; });
+
+            if (mStopping) {
+                return;
+            }
+
+            batch = mBatch;
+        }
+
+        work(queue);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <condition_variable>
+
+namespace nongravitar {
+    /**
+     * A fixed set of threads helping the update thread through batches of independent tasks.
+     *
+     * The tasks of a batch are dealt round-robin to a queue per thread, the calling thread included: every thread
+     * takes from the front of its own queue and, once that's empty, steals from the back of the others', so that a
+     * slow task doesn't hold up the ones dealt after it. A batch returns once all of its tasks are done.
+     *
+     * Without workers a batch runs in order on the calling thread, which is always the case on builds tracking the
+     * allocations since their scopes are meant for the update thread only.
+     */
+    class WorkerPool final {
+    public:
+        struct Task final {
+            void (*invoke)(void *);
+            void *data;
+        };
+
+        static constexpr auto MAX_TASKS = 16u;
+
+        WorkerPool() = delete; // no default-constructible
+
+        explicit WorkerPool(std::size_t workers);
+
+        WorkerPool(const WorkerPool &) = delete; // no copy-constructible
+        WorkerPool &operator=(const WorkerPool &) = delete; // no copy-assignable
+
+        WorkerPool(WorkerPool &&) = delete; // no move-constructible
+        WorkerPool &operator=(WorkerPool &&) = delete; // no move-assignable
+
+        ~WorkerPool();
+
+        /**
+         * Workers worth starting besides the calling thread, one per spare hardware thread up to the given maximum.
+         */
+        [[nodiscard]] static std::size_t spareWorkers(std::size_t max) noexcept;
+
+        /**
+         * Run a batch of at most MAX_TASKS tasks and wait for all of them.
+         *
+         * @warning
+         *  Tasks must not throw, they may run on any thread of the pool.
+         */
+        void run(const Task *tasks, std::size_t size);
+
+        [[nodiscard]] std::size_t getWorkers() const noexcept;
+
+    private:
+        struct Queue final {
+            std::mutex mutex;
+            std::array<std::size_t, MAX_TASKS> tasks;
+            std::size_t front{0u};
+            std::size_t back{0u};
+        };
+
+        [[nodiscard]] bool take(std::size_t queue, std::size_t &task) noexcept;
+        void work(std::size_t queue) noexcept;
+        void loop(std::size_t queue);
+
+        const std::size_t mWorkers;
+        std::unique_ptr<Queue[]> mQueues; // the one of the calling thread comes first
+        const Task *mTasks{nullptr};
+        std::atomic<std::size_t> mPending{0u};
+        std::uint64_t mBatch{0u};
+        bool mStopping{false};
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::condition_variable mDone;
+        std::vector<std::thread> mThreads;
+    };
+}
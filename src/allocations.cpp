@@ -0,0 +1,115 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <new>
+#include <cstdlib>
+#include <allocations.hpp>
+
+using namespace nongravitar;
+
+thread_local allocations::Counters threadCounters; // trivially constructible, so it never allocates itself
+std::array<allocations::Scope, allocations::MAX_SCOPES> scopes;
+
+allocations::Counters allocations::getCounters() noexcept {
+    return threadCounters;
+}
+
+void allocations::account(const char *const name, const Counters &counters) noexcept {
+    for (auto &scope : scopes) {
+        if (nullptr == scope.name or name == scope.name) {
+            scope.name = name;
+            scope.calls += 1u;
+            scope.counters.allocations += counters.allocations;
+            scope.counters.bytes += counters.bytes;
+            return;
+        }
+    }
+}
+
+const std::array<allocations::Scope, allocations::MAX_SCOPES> &allocations::getScopes() noexcept {
+    return scopes;
+}
+
+void allocations::resetScopes() noexcept {
+    scopes.fill(Scope());
+}
+
+#ifdef NONGRAVITAR_TRACK_ALLOCATIONS
+
+// over-aligned allocations keep the default operators, nothing in the game needs them
+void *operator new(const std::size_t size) {
+    threadCounters.allocations += 1u;
+    threadCounters.bytes += size;
+
+    if (const auto pointer = std::malloc(0u == size ? 1u : size); pointer) {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void *operator new[](const std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(const std::size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](const std::size_t size, const std::nothrow_t &) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void *const pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *const pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *const pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *const pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *const pointer, const std::nothrow_t &) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *const pointer, const std::nothrow_t &) noexcept {
+    std::free(pointer);
+}
+
+#endif
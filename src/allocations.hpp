@@ -0,0 +1,89 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Heap allocations accounting, opt-in through the NONGRAVITAR_TRACK_ALLOCATIONS build flag which replaces the global
+ * operator new; without it every counter stays at zero and scopes cost nothing.
+ */
+namespace nongravitar::allocations {
+    struct Counters final {
+        std::uint64_t allocations{0u};
+        std::uint64_t bytes{0u};
+    };
+
+    struct Scope final {
+        const char *name{nullptr};
+        std::uint64_t calls{0u};
+        Counters counters;
+    };
+
+    inline constexpr auto MAX_SCOPES = 32u;
+
+    [[nodiscard]] constexpr bool isTracking() noexcept {
+#ifdef NONGRAVITAR_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Allocations made so far by the calling thread, the render thread doesn't pollute the update thread counters.
+     */
+    [[nodiscard]] Counters getCounters() noexcept;
+
+    /**
+     * Add to the totals of a scope, scopes are told apart by the address of their name so names must be literals.
+     * Scopes are meant for the update thread only.
+     */
+    void account(const char *name, const Counters &counters) noexcept;
+
+    /**
+     * Totals of every scope so far, unused entries have no name.
+     */
+    [[nodiscard]] const std::array<Scope, MAX_SCOPES> &getScopes() noexcept;
+
+    void resetScopes() noexcept;
+
+    template<typename F>
+    inline void scope([[maybe_unused]] const char *name, F &&f) {
+#ifdef NONGRAVITAR_TRACK_ALLOCATIONS
+        const auto before = getCounters();
+        f();
+        const auto after = getCounters();
+        account(name, Counters{after.allocations - before.allocations, after.bytes - before.bytes});
+#else
+        f();
+#endif
+    }
+}
@@ -45,7 +45,9 @@ void AudioManager::initialize() {
 }
 
 void AudioManager::play(const SoundId id) noexcept {
-    if (not mMuted) {
+    mPlayed.at(helpers::enumValue(id)) += 1;
+
+    if (not mMuted and not mSilent) {
         mSounds.at(helpers::enumValue(id)).play();
     }
 }
@@ -58,7 +60,7 @@ void AudioManager::play(const SoundTrackId id) noexcept {
 
         mCurrentSoundtrackId = id;
 
-        if (SoundTrackId::None != mCurrentSoundtrackId) {
+        if (SoundTrackId::None != mCurrentSoundtrackId and not mSilent) {
             mSoundtracks.at(helpers::enumValue(mCurrentSoundtrackId)).play();
         }
     }
@@ -67,7 +69,7 @@ void AudioManager::play(const SoundTrackId id) noexcept {
 void AudioManager::toggle() noexcept {
     mMuted ^= true;
 
-    if (SoundTrackId::None != mCurrentSoundtrackId) {
+    if (SoundTrackId::None != mCurrentSoundtrackId and not mSilent) {
         auto &soundtrack = mSoundtracks.at(helpers::enumValue(mCurrentSoundtrackId));
         switch (soundtrack.getStatus()) {
             case sf::Music::Playing:
@@ -81,10 +83,33 @@ void AudioManager::toggle() noexcept {
     }
 }
 
+void AudioManager::setSilent(const bool silent) noexcept {
+    if (mSilent != silent) {
+        mSilent = silent;
+
+        if (SoundTrackId::None != mCurrentSoundtrackId and not mMuted) {
+            auto &soundtrack = mSoundtracks.at(helpers::enumValue(mCurrentSoundtrackId));
+            silent ? soundtrack.pause() : soundtrack.play();
+        }
+    }
+}
+
 SoundTrackId AudioManager::getPlaying() const noexcept {
     return mCurrentSoundtrackId;
 }
 
+bool AudioManager::isMuted() const noexcept {
+    return mMuted;
+}
+
+bool AudioManager::isSilent() const noexcept {
+    return mSilent;
+}
+
+unsigned long AudioManager::getPlayed(const SoundId id) const noexcept {
+    return mPlayed.at(helpers::enumValue(id));
+}
+
 void AudioManager::load(const char *const filename, const SoundId id) {
     auto path = std::string(NONGRAVITAR_SOUNDS_PATH "/") + filename;
 
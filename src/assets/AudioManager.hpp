@@ -70,8 +70,22 @@ namespace nongravitar::assets {
 
         void toggle() noexcept;
 
+        /**
+         * A silent manager keeps track of what would be playing without actually playing anything,
+         * it does not even need to be initialized.
+         */
+        void setSilent(bool silent) noexcept;
+
         [[nodiscard]] SoundTrackId getPlaying() const noexcept;
 
+        [[nodiscard]] bool isMuted() const noexcept;
+        [[nodiscard]] bool isSilent() const noexcept;
+
+        /**
+         * How many times a sound has been played, silent or not.
+         */
+        [[nodiscard]] unsigned long getPlayed(SoundId id) const noexcept;
+
     private:
         void load(const char *filename, SoundId id);
         void load(const char *filename, SoundTrackId id);
@@ -79,7 +93,9 @@ namespace nongravitar::assets {
         std::array<sf::Music, 3> mSoundtracks;
         std::array<sf::SoundBuffer, 4> mSoundBuffers;
         std::array<sf::Sound, 4> mSounds;
+        std::array<unsigned long, 4> mPlayed{};
         SoundTrackId mCurrentSoundtrackId{SoundTrackId::None};
         bool mMuted{false};
+        bool mSilent{false};
     };
 }
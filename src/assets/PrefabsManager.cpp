@@ -0,0 +1,139 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <tags.hpp>
+#include <components.hpp>
+#include <assets/PrefabsManager.hpp>
+
+using namespace nongravitar;
+using namespace nongravitar::tags;
+using namespace nongravitar::assets;
+using namespace nongravitar::components;
+
+/*
+ * The components of every prefab, in the order they are assigned to an instance.
+ */
+using Bullets = std::tuple<Bullet, Health, Damage, HitRadius, Renderable, Velocity>;
+using Terrains = std::tuple<Terrain, HitRadius, Renderable>;
+using AI1Bunkers = std::tuple<AI1, Bunker, Damage, Health, ReloadTime, HitRadius, Renderable>;
+using AI2Bunkers = std::tuple<AI2, Bunker, Damage, Health, ReloadTime, HitRadius, Renderable>;
+using EnergySupplies = std::tuple<Damage, Health, HitRadius, Renderable, Supply<Energy>>;
+using HealthSupplies = std::tuple<Damage, Health, HitRadius, Renderable, Supply<Health>>;
+
+float hitRadius(const SpriteSheetsManager &spriteSheetsManager, SpriteSheetId spriteSheetId, std::size_t frameIndex);
+
+template<typename ...Components>
+void clone(entt::registry &registry, entt::entity *first, entt::entity *last, entt::registry &prototypes, entt::entity prototype, std::tuple<Components...> *) {
+    registry.create<Components...>(first, last, prototype, prototypes);
+}
+
+void PrefabsManager::initialize(const SpriteSheetsManager &spriteSheetsManager) {
+    const auto prepare = [this](const PrefabId prefabId, auto &&... components) {
+        const auto prototype = mRegistry.create();
+        (mRegistry.assign<std::decay_t<decltype(components)>>(prototype, std::forward<decltype(components)>(components)), ...);
+        mPrototypes[helpers::enumValue(prefabId)] = prototype;
+    };
+
+    prepare(PrefabId::Bullet,
+            Bullet{}, Health(1), Damage(1),
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Bullet, 0)),
+            Renderable::sprite(SpriteSheetId::Bullet, 0),
+            Velocity{});
+
+    prepare(PrefabId::Terrain,
+            Terrain{},
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Terrain, 0)),
+            Renderable::sprite(SpriteSheetId::Terrain, 0));
+
+    prepare(PrefabId::AI1Bunker,
+            AI1{}, Bunker{}, Damage(2), Health(1), ReloadTime(0.0f),
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Bunker, 0)),
+            Renderable::sprite(SpriteSheetId::Bunker, 0));
+
+    prepare(PrefabId::AI2Bunker,
+            AI2{}, Bunker{}, Damage(3), Health(2), ReloadTime(0.0f),
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Bunker, 1)),
+            Renderable::sprite(SpriteSheetId::Bunker, 1));
+
+    prepare(PrefabId::EnergySupply,
+            Damage(1), Health(1),
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Supply, 1)),
+            Renderable::sprite(SpriteSheetId::Supply, 1),
+            Supply<Energy>(0.0f));
+
+    prepare(PrefabId::HealthSupply,
+            Damage(1), Health(1),
+            HitRadius(hitRadius(spriteSheetsManager, SpriteSheetId::Supply, 0)),
+            Renderable::sprite(SpriteSheetId::Supply, 0),
+            Supply<Health>(1));
+}
+
+void PrefabsManager::instantiate(entt::registry &registry, const PrefabId prefabId, const Transform *const transforms, const std::size_t count, entt::entity *const entities) {
+    const auto prototype = mPrototypes[helpers::enumValue(prefabId)];
+    const auto first = entities, last = entities + count;
+
+    switch (prefabId) {
+        case PrefabId::Bullet:
+            clone(registry, first, last, mRegistry, prototype, static_cast<Bullets *>(nullptr));
+            break;
+        case PrefabId::Terrain:
+            clone(registry, first, last, mRegistry, prototype, static_cast<Terrains *>(nullptr));
+            break;
+        case PrefabId::AI1Bunker:
+            clone(registry, first, last, mRegistry, prototype, static_cast<AI1Bunkers *>(nullptr));
+            break;
+        case PrefabId::AI2Bunker:
+            clone(registry, first, last, mRegistry, prototype, static_cast<AI2Bunkers *>(nullptr));
+            break;
+        case PrefabId::EnergySupply:
+            clone(registry, first, last, mRegistry, prototype, static_cast<EnergySupplies *>(nullptr));
+            break;
+        case PrefabId::HealthSupply:
+            clone(registry, first, last, mRegistry, prototype, static_cast<HealthSupplies *>(nullptr));
+            break;
+    }
+
+    for (auto i = std::size_t{0}; i < count; i++) {
+        auto &renderable = registry.get<Renderable>(entities[i]);
+        renderable.setPosition(transforms[i].position);
+        renderable.setRotation(transforms[i].rotation);
+    }
+}
+
+entt::entity PrefabsManager::instantiate(entt::registry &registry, const PrefabId prefabId, const Transform &transform) {
+    auto entity = entt::entity{};
+    instantiate(registry, prefabId, &transform, 1u, &entity);
+    return entity;
+}
+
+float hitRadius(const SpriteSheetsManager &spriteSheetsManager, const SpriteSheetId spriteSheetId, const std::size_t frameIndex) {
+    const auto &frame = spriteSheetsManager.get(spriteSheetId).getBuffer().at(frameIndex);
+    return std::max(frame.width, frame.height) / 2.0f;
+}
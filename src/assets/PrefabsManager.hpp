@@ -0,0 +1,100 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include <helpers.hpp>
+#include <assets/SpriteSheetsManager.hpp>
+
+namespace nongravitar::assets {
+    enum class PrefabId : std::size_t {
+        Bullet = 0,
+        Terrain,
+        AI1Bunker,
+        AI2Bunker,
+        EnergySupply,
+        HealthSupply,
+    };
+
+    /**
+     * Where an instance of a prefab is placed.
+     */
+    struct Transform final {
+        sf::Vector2f position;
+        float rotation;
+    };
+
+    /**
+     * Prototypes of the entities spawned over and over, their components are prepared once in a registry of their
+     * own and instances are cloned from them one pool at a time.
+     */
+    class PrefabsManager final {
+    public:
+        PrefabsManager() = default; // default-constructible
+
+        PrefabsManager(const PrefabsManager &) = delete; // no copy-constructible
+        PrefabsManager &operator=(const PrefabsManager &) = delete; // no copy-assignable
+
+        PrefabsManager(PrefabsManager &&) = delete; // no move-constructible
+        PrefabsManager &operator=(PrefabsManager &&) = delete; // no move-assignable
+
+        /**
+         * Initialize the prototypes of every prefab.
+         *
+         * @warning
+         *  This method should be called exactly once in the life-cycle of this object, any usage of this object
+         *  without proper initialization will result in a error.
+         *
+         *  Calling this method with a `SpriteSheetsManager` not properly initialized will result in an error.
+         */
+        void initialize(const SpriteSheetsManager &spriteSheetsManager);
+
+        /**
+         * Create an entity per transform in the given registry, all of them copies of the prefab placed by their
+         * transform. Entities are written in the same order as the transforms.
+         */
+        void instantiate(entt::registry &registry, PrefabId prefabId, const Transform *transforms, std::size_t count, entt::entity *entities);
+
+        entt::entity instantiate(entt::registry &registry, PrefabId prefabId, const Transform &transform);
+
+        /**
+         * A component of the prototype, e.g. to place instances by their hit radius.
+         */
+        template<typename Component>
+        [[nodiscard]] inline const Component &get(const PrefabId prefabId) const {
+            return mRegistry.get<Component>(mPrototypes[helpers::enumValue(prefabId)]);
+        }
+
+    private:
+        entt::registry mRegistry;
+        std::array<entt::entity, 6> mPrototypes{};
+    };
+}
@@ -0,0 +1,54 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <helpers.hpp>
+#include <autopilot.hpp>
+
+using namespace nongravitar;
+
+constexpr auto STEER_TOLERANCE = 4.0f;
+constexpr auto WIDE_TURN = 45.0f;
+
+void autopilot::steer(Input &input, const float bearing, const float targetBearing) noexcept {
+    using Key = sf::Keyboard::Key;
+    const auto turn = helpers::shortestRotation(bearing, targetBearing);
+
+    if (turn < -STEER_TOLERANCE) {
+        input.hold(Key::A);
+    } else if (turn > STEER_TOLERANCE) {
+        input.hold(Key::D);
+    }
+
+    input.hold(std::abs(turn) < WIDE_TURN ? Key::W : Key::S);
+}
+
+float autopilot::timeToClosestApproach(const sf::Vector2f &position, const sf::Vector2f &velocity, const sf::Vector2f &target) noexcept {
+    const auto speed = velocity.x * velocity.x + velocity.y * velocity.y;
+    const auto offset = target - position;
+    return 0.0f == speed ? -1.0f : (offset.x * velocity.x + offset.y * velocity.y) / speed;
+}
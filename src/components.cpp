@@ -25,6 +25,9 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <limits>
+#include <cassert>
+#include <helpers.hpp>
 #include <components.hpp>
 
 using namespace nongravitar::components;
@@ -100,6 +103,9 @@ float Energy::getValue() const noexcept {
 ReloadTime::ReloadTime(const float secondsBeforeShoot)
         : mElapsed(secondsBeforeShoot), mSecondsBeforeShoot(secondsBeforeShoot) {}
 
+ReloadTime::ReloadTime(const float secondsBeforeShoot, const float elapsed)
+        : mElapsed(elapsed), mSecondsBeforeShoot(secondsBeforeShoot) {}
+
 void ReloadTime::reset() {
     mElapsed = 0;
 }
@@ -110,26 +116,74 @@ void ReloadTime::elapse(sf::Time time) {
     }
 }
 
+float ReloadTime::getSecondsBeforeShoot() const noexcept {
+    return mSecondsBeforeShoot;
+}
+
+float ReloadTime::getElapsed() const noexcept {
+    return mElapsed;
+}
+
 /*
  * Renderable
  */
 
-void Renderable::draw(sf::RenderTarget &target, sf::RenderStates) const {
-    std::visit([&target](const auto &instance) { target.draw(instance); }, mInstance);
+Renderable::Renderable(const Shape shape, const std::uint8_t spriteSheetId, const std::uint16_t frameIndex, const float radius, const sf::Color color) noexcept
+        : mRadius(radius), mColor(color), mFrameIndex(frameIndex), mSpriteSheetId(spriteSheetId), mShape(shape) {}
+
+Renderable Renderable::sprite(const assets::SpriteSheetId spriteSheetId, const std::size_t frameIndex, const sf::Color color) noexcept {
+    assert(frameIndex <= std::numeric_limits<std::uint16_t>::max());
+    return Renderable(Shape::Sprite, static_cast<std::uint8_t>(spriteSheetId), static_cast<std::uint16_t>(frameIndex), 0.0f, color);
+}
+
+Renderable Renderable::disc(const float radius, const sf::Color color) noexcept {
+    return Renderable(Shape::Disc, 0u, 0u, radius, color);
+}
+
+Renderable Renderable::ring(const float radius, const sf::Color color) noexcept {
+    return Renderable(Shape::Ring, 0u, 0u, radius, color);
+}
+
+void Renderable::setPosition(const sf::Vector2f &position) noexcept {
+    mPosition = position;
+}
+
+void Renderable::setPosition(const float x, const float y) noexcept {
+    mPosition = sf::Vector2f(x, y);
+}
+
+void Renderable::move(const sf::Vector2f &offset) noexcept {
+    mPosition += offset;
+}
+
+void Renderable::setRotation(const float angle) noexcept {
+    mRotation = helpers::normalizeRotation(angle);
+}
+
+void Renderable::rotate(const float angle) noexcept {
+    setRotation(mRotation + angle);
+}
+
+void Renderable::setColor(const sf::Color color) noexcept {
+    mColor = color;
+}
+
+Renderable::Shape Renderable::getShape() const noexcept {
+    return mShape;
 }
 
-sf::Transformable &Renderable::operator*() {
-    return std::visit([](auto &instance) -> sf::Transformable & { return instance; }, mInstance);
+nongravitar::assets::SpriteSheetId Renderable::getSpriteSheetId() const noexcept {
+    return nongravitar::assets::SpriteSheetId(mSpriteSheetId);
 }
 
-const sf::Transformable &Renderable::operator*() const {
-    return std::visit([](const auto &instance) -> const sf::Transformable & { return instance; }, mInstance);
+std::size_t Renderable::getFrameIndex() const noexcept {
+    return mFrameIndex;
 }
 
-sf::Transformable *Renderable::operator->() {
-    return std::visit([](auto &instance) -> sf::Transformable * { return &instance; }, mInstance);
+float Renderable::getRadius() const noexcept {
+    return mRadius;
 }
 
-const sf::Transformable *Renderable::operator->() const {
-    return std::visit([](const auto &instance) -> const sf::Transformable * { return &instance; }, mInstance);
+sf::Color Renderable::getColor() const noexcept {
+    return mColor;
 }
@@ -27,10 +27,12 @@
 
 #pragma once
 
-#include <variant>
+#include <tuple>
+#include <cstdint>
 #include <entt/entt.hpp>
 #include <SFML/Graphics.hpp>
 #include <Scene.hpp>
+#include <assets/SpriteSheetsManager.hpp>
 
 namespace nongravitar::components {
     struct Velocity final {
@@ -129,6 +131,8 @@ namespace nongravitar::components {
     public:
         explicit ReloadTime(float secondsBeforeShoot);
 
+        ReloadTime(float secondsBeforeShoot, float elapsed);
+
         void reset();
 
         void elapse(sf::Time time);
@@ -137,6 +141,9 @@ namespace nongravitar::components {
             return mElapsed >= mSecondsBeforeShoot;
         }
 
+        [[nodiscard]] float getSecondsBeforeShoot() const noexcept;
+        [[nodiscard]] float getElapsed() const noexcept;
+
     private:
         float mElapsed;
         float mSecondsBeforeShoot;
@@ -155,30 +162,66 @@ namespace nongravitar::components {
         float mInstance;
     };
 
-    class Renderable final : public sf::Drawable {
+    /**
+     * What an entity looks like as plain data, geometry is resolved only by the renderer.
+     *
+     * Sprites are frames of a sprite sheet tinted by the colour, discs are filled by the colour and rings are outlined
+     * by it: all of them are centered on the position.
+     */
+    class Renderable final {
     public:
-        template<typename ...Args>
-        explicit Renderable(Args &&... args) : mInstance{std::forward<Args>(args)...} {}
+        enum class Shape : std::uint8_t {
+            Sprite = 0,
+            Disc,
+            Ring,
+        };
+
+        Renderable() = delete; // no default-constructible
+
+        [[nodiscard]] static Renderable sprite(assets::SpriteSheetId spriteSheetId, std::size_t frameIndex, sf::Color color = sf::Color::White) noexcept;
+        [[nodiscard]] static Renderable disc(float radius, sf::Color color) noexcept;
+        [[nodiscard]] static Renderable ring(float radius, sf::Color color) noexcept;
 
-        [[nodiscard]] sf::Transformable &operator*();
-        [[nodiscard]] const sf::Transformable &operator*() const;
+        void setPosition(const sf::Vector2f &position) noexcept;
+        void setPosition(float x, float y) noexcept;
+        void move(const sf::Vector2f &offset) noexcept;
 
-        [[nodiscard]] sf::Transformable *operator->();
-        [[nodiscard]] const sf::Transformable *operator->() const;
+        /**
+         * Angles are in degrees and kept within [0, 360) the same way sf::Transformable does.
+         */
+        void setRotation(float angle) noexcept;
+        void rotate(float angle) noexcept;
 
-        template<typename T>
-        [[nodiscard]] inline T &as() noexcept {
-            return std::get<T>(mInstance);
+        void setColor(sf::Color color) noexcept;
+
+        [[nodiscard]] inline const sf::Vector2f &getPosition() const noexcept {
+            return mPosition;
         }
 
-        template<typename T>
-        [[nodiscard]] inline const T &as() const noexcept {
-            return std::get<T>(mInstance);
+        [[nodiscard]] inline float getRotation() const noexcept {
+            return mRotation;
         }
 
-    private:
-        void draw(sf::RenderTarget &target, sf::RenderStates states) const final;
+        [[nodiscard]] Shape getShape() const noexcept;
+        [[nodiscard]] assets::SpriteSheetId getSpriteSheetId() const noexcept;
+        [[nodiscard]] std::size_t getFrameIndex() const noexcept;
+        [[nodiscard]] float getRadius() const noexcept;
+        [[nodiscard]] sf::Color getColor() const noexcept;
 
-        std::variant<sf::Sprite, sf::CircleShape> mInstance;
+    private:
+        Renderable(Shape shape, std::uint8_t spriteSheetId, std::uint16_t frameIndex, float radius, sf::Color color) noexcept;
+
+        sf::Vector2f mPosition;
+        float mRotation{0.0f};
+        float mRadius;
+        sf::Color mColor;
+        std::uint16_t mFrameIndex;
+        std::uint8_t mSpriteSheetId;
+        Shape mShape;
     };
+
+    /**
+     * The components of the player carried from a scene to another one, tags excluded.
+     */
+    using PlayerComponents = std::tuple<Score, Damage, Health, Energy, Velocity, ReloadTime, HitRadius, Renderable>;
 }
@@ -27,10 +27,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <SFML/Graphics.hpp>
 
 namespace nongravitar::constants {
     inline constexpr auto FPS = 60u;
+    inline constexpr auto FRAME_ARENA_CAPACITY = std::size_t{64u * 1024u};
+    inline constexpr auto MAX_SYSTEM_WORKERS = 3u;
 
     inline constexpr auto PLAYER_HEALTH = 8;
     inline constexpr auto PLAYER_ENERGY = 20'000.0f;
@@ -29,6 +29,31 @@
 
 using namespace nongravitar;
 
+/// splitmix64 (see: http://prng.di.unimi.it/splitmix64.c), the recommended way to expand a seed.
+std::uint64_t splitmix64(std::uint64_t &state) noexcept {
+    auto z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27u)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31u);
+}
+
+helpers::Seed helpers::deriveSeed(const Seed seed, const Stream stream, const std::uint64_t index) noexcept {
+    auto state = seed;
+    state = splitmix64(state) ^ enumValue(stream);
+    state = splitmix64(state) ^ index;
+    return splitmix64(state);
+}
+
+helpers::RandomEngine::RandomEngine(const Seed seed) noexcept : mState{} {
+    auto state = seed;
+
+    for (auto i = 0u; i < std::size(mState); i += 2) {
+        const auto z = splitmix64(state);
+        mState[i] = static_cast<result_type>(z);
+        mState[i + 1] = static_cast<result_type>(z >> 32u);
+    }
+}
+
 int helpers::signum(const float n) noexcept {
     return ((0.0f < n) - (n < 0.0f));
 }
@@ -44,3 +69,8 @@ float helpers::rad2deg(const float rad) noexcept {
 float helpers::shortestRotation(const float currentBearing, const float targetBearing) noexcept {
     return std::fmod(targetBearing - currentBearing + 540.0f, 360.0f) - 180.0f;
 }
+
+float helpers::normalizeRotation(const float angle) noexcept {
+    const auto rotation = static_cast<float>(std::fmod(angle, 360));
+    return rotation < 0 ? rotation + 360.0f : rotation;
+}
@@ -27,15 +27,131 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <limits>
 #include <random>
+#include <cstdint>
 #include <SFML/Graphics.hpp>
 
 namespace nongravitar::helpers {
+    using Seed = std::uint64_t;
+
+    /**
+     * Named random streams, each system derives its own stream from the seed of the scene it belongs to, so that
+     * consuming numbers in a system never shifts the sequence of another.
+     */
+    enum class Stream : std::uint64_t {
+        SolarSystem = 1,
+        Planet,
+        Terrain,
+        AI,
+    };
+
+    /**
+     * Derive the seed of an independent random stream, `index` tells apart several instances of the same stream.
+     */
+    Seed deriveSeed(Seed seed, Stream stream, std::uint64_t index = 0) noexcept;
+
+    /**
+     * xoshiro128** (see: http://prng.di.unimi.it), small and fast with the same output on every platform.
+     * Models the UniformRandomBitGenerator concept, numbers are drawn through the distributions below though.
+     */
+    class RandomEngine final {
+    public:
+        using result_type = std::uint32_t;
+        using State = std::array<result_type, 4>;
+
+        explicit RandomEngine(Seed seed) noexcept;
+
+        [[nodiscard]] inline const State &getState() const noexcept {
+            return mState;
+        }
+
+        inline void setState(const State &state) noexcept {
+            mState = state;
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        [[nodiscard]] static constexpr result_type max() noexcept {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        inline result_type operator()() noexcept {
+            const auto result = rotl(mState[1] * 5u, 7) * 9u;
+            const auto t = mState[1] << 9u;
+
+            mState[2] ^= mState[0];
+            mState[3] ^= mState[1];
+            mState[1] ^= mState[2];
+            mState[0] ^= mState[3];
+            mState[2] ^= t;
+            mState[3] = rotl(mState[3], 11);
+
+            return result;
+        }
+
+    private:
+        [[nodiscard]] static constexpr result_type rotl(const result_type x, const int k) noexcept {
+            return (x << k) | (x >> (32 - k));
+        }
+
+        State mState;
+    };
+
     using RandomDevice = std::random_device;
-    using RandomEngine = std::default_random_engine;
-    using IntDistribution = std::uniform_int_distribution<int>;
-    using FloatDistribution = std::uniform_real_distribution<float>;
+
+    /**
+     * Uniform integers in [min, max], bounded the way Lemire does (see: https://arxiv.org/abs/1805.10941).
+     * The std distributions leave their algorithms to the standard library, these give the same numbers everywhere.
+     */
+    class IntDistribution final {
+    public:
+        IntDistribution(const int min, const int max) noexcept :
+                mMin{min},
+                mRange{static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min + 1)} {}
+
+        inline int operator()(RandomEngine &randomEngine) noexcept {
+            auto x = randomEngine();
+
+            if (0u == mRange) { // the whole range of int
+                return static_cast<int>(static_cast<std::int64_t>(mMin) + x);
+            }
+
+            auto m = static_cast<std::uint64_t>(x) * mRange;
+            if (auto l = static_cast<std::uint32_t>(m); l < mRange) {
+                for (const auto t = static_cast<std::uint32_t>(-mRange) % mRange; l < t; l = static_cast<std::uint32_t>(m)) {
+                    x = randomEngine();
+                    m = static_cast<std::uint64_t>(x) * mRange;
+                }
+            }
+
+            return static_cast<int>(static_cast<std::int64_t>(mMin) + static_cast<std::int64_t>(m >> 32u));
+        }
+
+    private:
+        int mMin;
+        std::uint32_t mRange;
+    };
+
+    /**
+     * Uniform floats in [min, max), the upper 24 bits of a draw scaled to [0, 1) and mapped to the range.
+     */
+    class FloatDistribution final {
+    public:
+        FloatDistribution(const float min, const float max) noexcept : mMin{min}, mSpan{max - min} {}
+
+        inline float operator()(RandomEngine &randomEngine) noexcept {
+            return mMin + static_cast<float>(randomEngine() >> 8u) * 0x1p-24f * mSpan;
+        }
+
+    private:
+        float mMin;
+        float mSpan;
+    };
 
     template<typename F, typename ...Args>
     inline constexpr void debug([[maybe_unused]] F &&f, [[maybe_unused]] Args &&...args) {
@@ -69,6 +185,8 @@ namespace nongravitar::helpers {
 
     float shortestRotation(float currentBearing, float targetBearing) noexcept;
 
+    float normalizeRotation(float angle) noexcept;
+
     template<typename T>
     float magnitude(const sf::Vector2<T> &origin, const sf::Vector2<T> &point) noexcept {
         return std::sqrt(std::pow(point.x - origin.x, 2) + std::pow(point.y - origin.y, 2));
@@ -25,11 +25,21 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <iostream>
 #include <Game.hpp>
 
 using namespace nongravitar;
 
-int main() {
-    auto game = Game();
+int main(int argc, char *argv[]) {
+    auto options = Options();
+
+    try {
+        options = Options::parse(argc, argv);
+    } catch (const std::invalid_argument &e) {
+        std::cerr << e.what() << std::endl << Options::usage();
+        return 1;
+    }
+
+    auto game = Game(options);
     return game.initialize().run();
 }
@@ -29,10 +29,13 @@
 
 using namespace nongravitar::messages;
 
-SolarSystemEntered::SolarSystemEntered(const sf::RenderWindow &window, entt::registry &registry, const SceneId sceneId, const unsigned bonus)
-        : window(window), registry(registry), sceneId(sceneId), bonus(bonus) {}
+SolarSystemEntered::SolarSystemEntered(const sf::FloatRect &viewport, entt::registry &registry, const SceneId sceneId, const unsigned bonus)
+        : viewport(viewport), registry(registry), sceneId(sceneId), bonus(bonus) {}
 
-PlanetEntered::PlanetEntered(const sf::RenderWindow &window, entt::registry &registry, const SceneId sceneId)
-        : window(window), registry(registry), sceneId(sceneId) {}
+PlanetApproached::PlanetApproached(const sf::FloatRect &viewport, const Assets &assets, const SceneId sceneId)
+        : viewport(viewport), assets(assets), sceneId(sceneId) {}
+
+PlanetEntered::PlanetEntered(const sf::FloatRect &viewport, Assets &assets, entt::registry &registry, const SceneId sceneId)
+        : viewport(viewport), assets(assets), registry(registry), sceneId(sceneId) {}
 
 GameOver::GameOver(const unsigned score) : score(score) {}
@@ -32,18 +32,27 @@
 
 namespace nongravitar::messages {
     struct SolarSystemEntered final {
-        SolarSystemEntered(const sf::RenderWindow &window, entt::registry &registry, SceneId sceneId, unsigned bonus);
+        SolarSystemEntered(const sf::FloatRect &viewport, entt::registry &registry, SceneId sceneId, unsigned bonus);
 
-        const sf::RenderWindow &window;
+        const sf::FloatRect viewport;
         entt::registry &registry; // FIXME this should be const but EnTT requires a mutable &
         const SceneId sceneId; // source planet SceneId
         const unsigned bonus;
     };
 
+    struct PlanetApproached final {
+        PlanetApproached(const sf::FloatRect &viewport, const Assets &assets, SceneId sceneId);
+
+        const sf::FloatRect viewport;
+        const Assets &assets;
+        const SceneId sceneId; // approached planet SceneId
+    };
+
     struct PlanetEntered final {
-        PlanetEntered(const sf::RenderWindow &window, entt::registry &registry, SceneId sceneId);
+        PlanetEntered(const sf::FloatRect &viewport, Assets &assets, entt::registry &registry, SceneId sceneId);
 
-        const sf::RenderWindow &window;
+        const sf::FloatRect viewport;
+        Assets &assets;
         entt::registry &registry; // FIXME this should be const but EnTT requires a mutable &
         const SceneId sceneId; // destination planet SceneId
     };
@@ -0,0 +1,48 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+#include <entt/entt.hpp>
+
+namespace nongravitar::migration {
+    /**
+     * Moves the given components of an entity over the ones of an entity of another registry.
+     *
+     * The destination entity is meant to outlive the migrations: once it's in the pools of the components, moving an
+     * entity back and forth is a handful of assignments, no entity is created nor memory allocated.
+     *
+     * @warning
+     *  Components must not be empty types (i.e. tags), the destination entity is expected to have them already.
+     */
+    template<typename ...Components>
+    void migrate(entt::registry &source, const entt::entity sourceId, entt::registry &destination, const entt::entity destinationId, std::tuple<Components...> * = nullptr) {
+        (destination.assign_or_replace<Components>(destinationId, std::move(source.get<Components>(sourceId))), ...);
+    }
+}
@@ -45,6 +45,9 @@ namespace nongravitar::pubsub {
         template<typename U>
         friend void unsubscribe(const Handler<U> &handler);
 
+        template<typename U>
+        friend std::size_t subscribers() noexcept;
+
         virtual ~Handler();
 
     protected:
@@ -79,6 +82,14 @@ namespace nongravitar::pubsub {
         Handler<T>::mHandlers.erase(const_cast<Handler<T> *>(&handler));
     }
 
+    /**
+     * Number of handlers currently subscribed to messages of type T.
+     */
+    template<typename T>
+    std::size_t subscribers() noexcept {
+        return Handler<T>::mHandlers.size();
+    }
+
     template<typename T>
     Handler<T>::~Handler() {
         unsubscribe<T>(*this);
@@ -25,48 +25,53 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
-#include <helpers.hpp>
+#include <cstring>
+#include <Archive.hpp>
 #include <scene/LeaderBoard.hpp>
 
 using namespace nongravitar;
 using namespace nongravitar::scene;
 using namespace nongravitar::assets;
 
-LeaderBoard &LeaderBoard::initialize(Assets &assets) noexcept {
+LeaderBoard &LeaderBoard::initialize() noexcept {
     pubsub::subscribe(*this);
 
-    mGameOverTitle.setFont(assets.getFontsManager().get(FontId::Mechanical));
-    mGameOverTitle.setCharacterSize(64);
+    mGameOverTitle.fontId = FontId::Mechanical;
+    mGameOverTitle.characterSize = 64u;
 
-    mSpaceLabel.setFont(assets.getFontsManager().get(FontId::Mechanical));
-    mSpaceLabel.setCharacterSize(32);
-    mSpaceLabel.setString("[ESC]");
-    helpers::centerOrigin(mSpaceLabel, mSpaceLabel.getLocalBounds());
+    mSpaceLabel.fontId = FontId::Mechanical;
+    mSpaceLabel.characterSize = 32u;
+    std::strncpy(mSpaceLabel.string.data(), "[ESC]", mSpaceLabel.string.size() - 1);
 
     return *this;
 }
 
-SceneId LeaderBoard::update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept {
-    const auto[windowWidth, windowHeight] = window.getSize();
+SceneId LeaderBoard::update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept {
+    const auto windowWidth = viewport.width, windowHeight = viewport.height;
 
     if (auto &audioManager = assets.getAudioManager(); SoundTrackId::AmbientStarfield != audioManager.getPlaying()) {
         audioManager.play(SoundTrackId::AmbientStarfield);
     }
 
-    mGameOverTitle.setPosition(windowWidth / 2.0f, windowHeight / 3.14f);
-    mSpaceLabel.setPosition(windowWidth / 2.0f, windowHeight / 1.12f);
+    mGameOverTitle.position = sf::Vector2f(windowWidth / 2.0f, windowHeight / 3.14f);
+    mSpaceLabel.position = sf::Vector2f(windowWidth / 2.0f, windowHeight / 1.12f);
 
-    return Scene::update(window, sceneManager, assets, elapsed);
+    return Scene::update(viewport, sceneManager, assets, frameArena, workerPool, input, elapsed);
 }
 
-void LeaderBoard::render(sf::RenderTarget &window) const noexcept {
-    window.draw(mGameOverTitle);
-    window.draw(mSpaceLabel);
+void LeaderBoard::render(RenderSnapshot &snapshot) const noexcept {
+    snapshot.draw(mGameOverTitle);
+    snapshot.draw(mSpaceLabel);
+}
+
+void LeaderBoard::save(OutputArchive &archive) const {
+    archive.write(mGameOverTitle);
+}
+
+void LeaderBoard::load(InputArchive &archive) {
+    archive.read(mGameOverTitle);
 }
 
 void LeaderBoard::operator()(const messages::GameOver &message) noexcept {
-    char buffer[64];
-    snprintf(buffer, std::size(buffer), "  Game Over\n\n\nScore: %05u", message.score);
-    mGameOverTitle.setString(buffer);
-    helpers::centerOrigin(mGameOverTitle, mGameOverTitle.getLocalBounds());
+    snprintf(mGameOverTitle.string.data(), mGameOverTitle.string.size(), "  Game Over\n\n\nScore: %05u", message.score);
 }
@@ -30,6 +30,7 @@
 #include <Scene.hpp>
 #include <pubsub.hpp>
 #include <messages.hpp>
+#include <RenderSnapshot.hpp>
 
 namespace nongravitar::scene {
     class LeaderBoard final : public Scene,
@@ -48,16 +49,20 @@ namespace nongravitar::scene {
          *  This method should be called exactly once in the life-cycle of this object, any usage of this object
          *  without proper initialization will result in a error.
          */
-        LeaderBoard &initialize(Assets &assets) noexcept;
+        LeaderBoard &initialize() noexcept;
 
-        SceneId update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept final;
+        SceneId update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept final;
 
-        void render(sf::RenderTarget &window) const noexcept final;
+        void render(RenderSnapshot &snapshot) const noexcept final;
+
+        void save(OutputArchive &archive) const final;
+
+        void load(InputArchive &archive) final;
 
     private:
         void operator()(const messages::GameOver &message) noexcept final;
 
-        sf::Text mGameOverTitle;
-        sf::Text mSpaceLabel;
+        Label mGameOverTitle;
+        Label mSpaceLabel;
     };
 }
@@ -27,8 +27,14 @@
 
 #include <tags.hpp>
 #include <pubsub.hpp>
+#include <Archive.hpp>
+#include <StateHash.hpp>
+#include <SystemScheduler.hpp>
+#include <CheckedRegistry.hpp>
 #include <helpers.hpp>
+#include <autopilot.hpp>
 #include <messages.hpp>
+#include <migration.hpp>
 #include <constants.hpp>
 #include <components.hpp>
 #include <scene/PlanetAssault.hpp>
@@ -41,100 +47,376 @@ using namespace nongravitar::messages;
 using namespace nongravitar::constants;
 using namespace nongravitar::components;
 
-using helpers::RandomDevice;
+using helpers::Stream;
 using helpers::IntDistribution;
 using helpers::FloatDistribution;
 
 constexpr auto TERRAIN_SEGMENTS_PER_UNIT = 4u;
+constexpr auto TERRAIN_MAX_SLOPE = 32.0f;
+constexpr auto AUTOPILOT_DODGE_HORIZON = 0.5f;
+constexpr auto AUTOPILOT_TERRAIN_CLEARANCE = 48.0f;
+constexpr auto AUTOPILOT_HOVER_HEIGHT = 160.0f;
+constexpr auto AUTOPILOT_AIM_TOLERANCE = 6.0f;
+constexpr auto AUTOPILOT_EXIT_BEARING = 270.0f;
+
+// what systems share besides components and entities, every system reads the entities and the command system alone
+// writes them
+namespace nongravitar::resources {
+    struct Audio;
+    struct AIRandom;
+    struct Reloads;
+    struct Report;
+    struct NextScene;
+    struct Messages;
+    struct Commands;
+}
 
-void shoot(entt::registry &registry, Assets &assets, const sf::Vector2f &position, float rotation) noexcept;
+void harm(CheckedRegistry &registry, entt::entity entity, const Damage &damage) noexcept;
+
+void kill(CheckedRegistry &registry, entt::entity entity) noexcept;
+
+std::vector<SystemScheduler::System> systems() {
+    using namespace resources;
+    using S = SystemScheduler;
+
+    // declaration order is the order of update: input, {motion, reload}, collision, {AI, report}, liveness, command.
+    // Hidden is excluded by owning groups, toggling it moves the owned Renderable and Tractor around their pools; Dirty
+    // stays a plain pool write since liveness consumes it within the tick
+    return {
+            {"PlanetAssault::inputSystem",
+                    S::access<Entities, Player, HitRadius, EntityRef<Tractor>>(),
+                    S::access<Renderable, Tractor, Energy, Velocity, ReloadTime, Dirty, Hidden, Commands>()},
+            {"PlanetAssault::motionSystem",
+                    S::access<Entities, Velocity>(),
+                    S::access<Renderable>()},
+            {"PlanetAssault::collisionSystem",
+                    S::access<Entities, Player, Tractor, Bullet, Terrain, Hidden, Damage, HitRadius, EntityRef<Player>, Supply<Energy>, Supply<Health>>(),
+                    S::access<Renderable, Velocity, Health, Energy, Dirty, Audio, NextScene, Commands>()},
+            {"PlanetAssault::reloadSystem",
+                    S::access<Entities, Player>(),
+                    S::access<ReloadTime, Reloads>()},
+            {"PlanetAssault::AISystem",
+                    S::access<Entities, Player, AI1, Renderable, HitRadius, ReloadTime>(),
+                    S::access<Reloads, AIRandom, Commands>()},
+            {"PlanetAssault::livenessSystem",
+                    S::access<Entities, Player, Bunker, Health, Energy, Score>(),
+                    S::access<Dirty, Audio, NextScene, Messages, Commands>()},
+            {"PlanetAssault::reportSystem",
+                    S::access<Entities, Player, Health, Energy, Score>(),
+                    S::access<Report>()},
+            {"PlanetAssault::commandSystem",
+                    S::access<NextScene>(),
+                    S::access<Entities, Audio, Messages, Commands>()}
+    };
+}
 
-PlanetAssault::PlanetAssault(const SceneId solarSystemSceneId, const SceneId leaderBoardSceneId) :
-        mBuffer{},
-        mRandomEngine{RandomDevice()()},
+const SystemScheduler &scheduler() {
+    // the declarations are the same for every planet
+    static const auto scheduler = SystemScheduler(systems());
+    return scheduler;
+}
+
+PlanetAssault::PlanetAssault(const SceneId solarSystemSceneId, const SceneId leaderBoardSceneId, const helpers::Seed seed) :
+        mTerrainRandomEngine{helpers::deriveSeed(seed, Stream::Terrain)},
+        mAIRandomEngine{helpers::deriveSeed(seed, Stream::AI)},
+        mAI1Precision{-16.0f, 16.0f},
+        mAI2Precision{-8.0f, 8.0f},
         mLeaderBoardSceneId{leaderBoardSceneId},
         mSolarSystemSceneId{solarSystemSceneId} {}
 
-PlanetAssault &PlanetAssault::initialize(const sf::RenderWindow &window, Assets &assets, sf::Color terrainColor) noexcept {
+PlanetAssault &PlanetAssault::initialize(const sf::FloatRect &, Assets &, const sf::Color terrainColor) noexcept {
+    // the terrain is generated when the player lands for the first time, a planet never visited costs its seed only
+    mTerrainColor = terrainColor;
+
     initializeGroups();
-    initializeReport(assets);
-    initializeTerrain(window, assets, terrainColor);
+    initializeReport();
     initializePubSub();
     return *this;
 }
 
-SceneId PlanetAssault::update(const sf::RenderWindow &window, SceneManager &, Assets &assets, const sf::Time elapsed) noexcept {
+PlanetAssault::Layout PlanetAssault::generateLayout(const sf::FloatRect &viewport, const Assets &assets) const noexcept {
+    auto randomEngine = mTerrainRandomEngine;
+    const auto &prefabsManager = assets.getPrefabsManager();
+    const auto halfWindowHeight = viewport.height / 2.0f;
+    const auto terrainHitRadius = *prefabsManager.get<HitRadius>(PrefabId::Terrain);
+    const auto terrainHitDiameter = terrainHitRadius * 2.0f;
+    auto rotationDistribution = FloatDistribution(-TERRAIN_MAX_SLOPE, TERRAIN_MAX_SLOPE);
+    auto terrainPosition = sf::Vector2f(
+            0.0f,
+            FloatDistribution(halfWindowHeight * 1.5f + terrainHitDiameter, halfWindowHeight * 2.0f - terrainHitDiameter)(randomEngine)
+    );
+
+    // every unit moves the walk rightwards by at least cos(TERRAIN_MAX_SLOPE) of its length, hence an upper bound of
+    // the units crossing the viewport: arrays are sized once and never grow while the terrain is generated
+    const auto unitWidth = terrainHitDiameter * TERRAIN_SEGMENTS_PER_UNIT * std::cos(helpers::deg2rad(TERRAIN_MAX_SLOPE));
+    const auto maxUnits = static_cast<std::size_t>(std::ceil(viewport.width / unitWidth)) + 1u;
+    auto layout = Layout();
+
+    layout.viewport = viewport;
+    layout.terrain.reserve(maxUnits * TERRAIN_SEGMENTS_PER_UNIT);
+    for (auto spawns : {&layout.AI1Bunkers, &layout.AI2Bunkers, &layout.energySupplies, &layout.healthSupplies}) {
+        spawns->transforms.reserve(maxUnits);
+        spawns->values.reserve(maxUnits);
+    }
+
+    do {
+        // rotations are stored the way renderables normalize them, so that what stands on the terrain doesn't depend
+        // on whether it is placed from the layout or from the registry
+        const auto terrainRotation = helpers::normalizeRotation(rotationDistribution(randomEngine));
+        const auto terrainOffset = helpers::makeVector2(terrainRotation, terrainHitRadius);
+
+        for (auto i = 0u; i < TERRAIN_SEGMENTS_PER_UNIT; i++) {
+            terrainPosition += terrainOffset;
+            layout.terrain.push_back(Transform{terrainPosition, terrainRotation});
+            terrainPosition += terrainOffset;
+        }
+    } while (viewport.contains(terrainPosition));
+
+    auto AI1ReloadDistribution = FloatDistribution(1.64f, 2.28f);
+    auto AI2ReloadDistribution = FloatDistribution(1.96f, 2.28f);
+    auto energySupplyDistribution = FloatDistribution(2000.0f, 4000.0f);
+    auto entityDistribution = IntDistribution(1, 16);
+
+    // units are visited from the last one to the first one through their last segment, the order in which the
+    // terrain used to be visited in the registry, so that the same seed keeps producing the same planet
+    for (auto unit = layout.terrain.size() / TERRAIN_SEGMENTS_PER_UNIT; unit-- > 0u;) {
+        const auto &terrainTransform = layout.terrain[unit * TERRAIN_SEGMENTS_PER_UNIT + TERRAIN_SEGMENTS_PER_UNIT - 1u];
+        const auto position = terrainTransform.position +
+                              helpers::makeVector2(terrainTransform.rotation + 180.0f, terrainHitRadius * (TERRAIN_SEGMENTS_PER_UNIT - 1u));
+
+        const auto standOn = [&](Layout::Spawns &spawns, const PrefabId prefabId, const float value) {
+            const auto hitRadius = *prefabsManager.get<HitRadius>(prefabId);
+            spawns.transforms.push_back(Transform{
+                    position + helpers::makeVector2(terrainTransform.rotation + 270.0f, hitRadius),
+                    terrainTransform.rotation + 180.0f
+            });
+            spawns.values.push_back(value);
+        };
+
+        switch (entityDistribution(randomEngine)) {
+            case 2:
+            case 16:
+                standOn(layout.AI1Bunkers, PrefabId::AI1Bunker, AI1ReloadDistribution(randomEngine));
+                break;
+
+            case 8:
+                standOn(layout.AI2Bunkers, PrefabId::AI2Bunker, AI2ReloadDistribution(randomEngine));
+                break;
+
+            case 4:
+                standOn(layout.energySupplies, PrefabId::EnergySupply, energySupplyDistribution(randomEngine));
+                break;
+
+            case 6:
+            case 12:
+                standOn(layout.healthSupplies, PrefabId::HealthSupply, 0.0f);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return layout;
+}
+
+SceneId PlanetAssault::update(const sf::FloatRect &viewport, SceneManager &, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, const sf::Time elapsed) noexcept {
     mNextSceneId = getSceneId();
 
     if (auto &audioManager = assets.getAudioManager(); SoundTrackId::ComputerAdventures != audioManager.getPlaying()) {
         audioManager.play(SoundTrackId::ComputerAdventures);
     }
 
-    inputSystem(assets, elapsed);
-    motionSystem(elapsed);
-    collisionSystem(window, assets, elapsed);
-    reloadSystem(elapsed);
-    AISystem(assets);
-    livenessSystem(assets);
-    reportSystem(window);
+    scheduler().run(
+            workerPool,
+            [&]() { inputSystem(input, elapsed); },
+            [&]() { motionSystem(elapsed); },
+            [&]() { collisionSystem(viewport, assets, elapsed); },
+            [&]() { reloadSystem(elapsed); },
+            [&]() { AISystem(); },
+            [&]() { livenessSystem(assets, frameArena); },
+            [&]() { reportSystem(viewport); },
+            [&]() { commandSystem(viewport, assets); }
+    );
 
     return mNextSceneId;
 }
 
-void PlanetAssault::render(sf::RenderTarget &window) const noexcept {
-    window.draw(mReport);
+void PlanetAssault::render(RenderSnapshot &snapshot) const noexcept {
+    snapshot.draw(mReport);
 
     mRegistry.group<const Renderable>(entt::exclude < Hidden > ).each([&](const auto id, const auto &renderable) {
         helpers::debug([&]() { // display hit-circle on debug builds only
             if (const auto hitRadius = mRegistry.try_get<HitRadius>(id); hitRadius) {
-                auto shape = sf::CircleShape(**hitRadius);
-                helpers::centerOrigin(shape, shape.getLocalBounds());
-                shape.setPosition(renderable->getPosition());
-                shape.setFillColor(sf::Color::Transparent);
-                shape.setOutlineColor(sf::Color::Red);
-                shape.setOutlineThickness(1);
-                window.draw(shape);
+                auto shape = Renderable::ring(**hitRadius, sf::Color::Red);
+                shape.setPosition(renderable.getPosition());
+                snapshot.draw(shape);
             }
         });
 
-        window.draw(renderable);
+        snapshot.draw(renderable);
     });
 }
 
+std::optional<Input> PlanetAssault::autopilot(const sf::FloatRect &viewport) const noexcept {
+    using Key = sf::Keyboard::Key;
+    auto input = Input();
+
+    const auto players = mRegistry.view<const Player, const Renderable, const HitRadius, const Health, const Energy>();
+    for (const auto playerId : players) {
+        const auto &[playerRenderable, playerHitRadius, playerHealth, playerEnergy] =
+                players.get<const Renderable, const HitRadius, const Health, const Energy>(playerId);
+        const auto playerPosition = playerRenderable.getPosition();
+        const auto playerBearing = playerRenderable.getRotation();
+
+        // dodge the bullet that is going to hit us first
+        auto dodgeTime = AUTOPILOT_DODGE_HORIZON;
+        auto dodgePoint = std::optional<sf::Vector2f>();
+        mRegistry.view<const Bullet, const Renderable, const Velocity>().each([&](const auto, const auto &bulletRenderable, const auto &bulletVelocity) {
+            const auto time = autopilot::timeToClosestApproach(bulletRenderable.getPosition(), bulletVelocity.value, playerPosition);
+            const auto closest = bulletRenderable.getPosition() + bulletVelocity.value * time;
+
+            if (time >= 0.0f and time < dodgeTime and helpers::magnitude(closest, playerPosition) <= 2.0f * *playerHitRadius) {
+                dodgeTime = time;
+                dodgePoint = closest;
+            }
+        });
+
+        if (dodgePoint) {
+            autopilot::steer(input, playerBearing, helpers::rotation(*dodgePoint, playerPosition));
+            return input;
+        }
+
+        // stay away from the terrain
+        auto terrainDistance = AUTOPILOT_TERRAIN_CLEARANCE;
+        auto terrainPoint = std::optional<sf::Vector2f>();
+        mRegistry.view<const Terrain, const Renderable, const HitRadius>().each([&](const auto, const auto &terrainRenderable, const auto &terrainHitRadius) {
+            const auto distance = helpers::magnitude(terrainRenderable.getPosition(), playerPosition) - *terrainHitRadius - *playerHitRadius;
+
+            if (distance < terrainDistance) {
+                terrainDistance = distance;
+                terrainPoint = terrainRenderable.getPosition();
+            }
+        });
+
+        if (terrainPoint) {
+            autopilot::steer(input, playerBearing, helpers::rotation(*terrainPoint, playerPosition));
+            return input;
+        }
+
+        // grab the supplies in reach, go looking for them when running low
+        const auto isLow = playerHealth.getValue() < PLAYER_HEALTH / 2 or playerEnergy.getValue() < PLAYER_ENERGY / 4.0f;
+        auto supplyDistance = std::numeric_limits<float>::max();
+        auto supplyPoint = std::optional<sf::Vector2f>();
+        const auto visitSupply = [&](const auto, const auto &supplyRenderable) {
+            if (const auto distance = helpers::magnitude(playerPosition, supplyRenderable.getPosition()); distance < supplyDistance) {
+                supplyDistance = distance;
+                supplyPoint = supplyRenderable.getPosition();
+            }
+        };
+        mRegistry.view<const Supply<Energy>, const Renderable>().each([&](const auto id, const auto, const auto &renderable) { visitSupply(id, renderable); });
+        mRegistry.view<const Supply<Health>, const Renderable>().each([&](const auto id, const auto, const auto &renderable) { visitSupply(id, renderable); });
+
+        if (supplyDistance <= TRACTOR_RADIUS) {
+            input.hold(Key::RShift);
+        }
+
+        if (isLow and supplyPoint) {
+            autopilot::steer(input, playerBearing, helpers::rotation(playerPosition, *supplyPoint));
+            return input;
+        }
+
+        // hover above the closest bunker and shoot it down
+        auto bunkerDistance = std::numeric_limits<float>::max();
+        auto bunkerPoint = std::optional<sf::Vector2f>();
+        mRegistry.view<const Bunker, const Renderable>().each([&](const auto, const auto &bunkerRenderable) {
+            if (const auto distance = helpers::magnitude(playerPosition, bunkerRenderable.getPosition()); distance < bunkerDistance) {
+                bunkerDistance = distance;
+                bunkerPoint = bunkerRenderable.getPosition();
+            }
+        });
+
+        if (bunkerPoint) {
+            const auto bunkerBearing = helpers::rotation(playerPosition, *bunkerPoint);
+            const auto hoverPoint = *bunkerPoint - sf::Vector2f(0.0f, AUTOPILOT_HOVER_HEIGHT);
+
+            if (std::abs(helpers::shortestRotation(playerBearing, bunkerBearing)) <= AUTOPILOT_AIM_TOLERANCE and viewport.contains(*bunkerPoint)) {
+                input.hold(Key::Space);
+            }
+
+            if (helpers::magnitude(playerPosition, hoverPoint) > *playerHitRadius) {
+                autopilot::steer(input, playerBearing, helpers::rotation(playerPosition, hoverPoint));
+            } else { // turn towards the bunker once on the hover point
+                autopilot::steer(input, playerBearing, bunkerBearing);
+            }
+        } else { // nothing left to destroy, back to the solar system
+            autopilot::steer(input, playerBearing, AUTOPILOT_EXIT_BEARING);
+        }
+    }
+
+    return input;
+}
+
+void PlanetAssault::save(OutputArchive &archive) const {
+    archive.write(mRegistry);
+    archive.write(mReport);
+    archive.write(mTerrainRandomEngine);
+    archive.write(mAIRandomEngine);
+    archive.write(mNextSceneId);
+    archive.write(mBonus);
+    archive.write(mTerrainColor);
+    archive.write(mTerrainGenerated);
+    archive.write(mReloads);
+}
+
+void PlanetAssault::load(InputArchive &archive) {
+    // a layout prefetched from the previous state could be drawn from a different engine
+    mLayout = std::future<Layout>();
+
+    archive.read(mRegistry);
+    archive.read(mReport);
+    archive.read(mTerrainRandomEngine);
+    archive.read(mAIRandomEngine);
+    archive.read(mNextSceneId);
+    archive.read(mBonus);
+    archive.read(mTerrainColor);
+    archive.read(mTerrainGenerated);
+    archive.read(mReloads);
+}
+
+void PlanetAssault::hash(StateHash &hash) const noexcept {
+    hash.add(getSceneId(), mRegistry);
+    hash.add(mReloads);
+}
+
+void PlanetAssault::operator()(const PlanetApproached &message) noexcept {
+    if (message.sceneId == getSceneId() and not mTerrainGenerated and not mLayout.valid()) {
+        mLayout = std::async(std::launch::async, [this, viewport = message.viewport, &assets = message.assets]() {
+            return generateLayout(viewport, assets);
+        });
+    }
+}
+
 void PlanetAssault::operator()(const PlanetEntered &message) noexcept {
     if (message.sceneId == getSceneId()) {
-        const auto players = mRegistry.view<Player>();
-        const auto tractors = mRegistry.view<Tractor>();
-
-        mRegistry.destroy(players.begin(), players.end());
-        mRegistry.destroy(tractors.begin(), tractors.end());
+        generateTerrain(message.viewport, message.assets);
 
         for (const auto sourcePlayerId : message.registry.view<Player>()) {
-            const auto[windowWidth, windowHeight] = sf::Vector2f(message.window.getSize());
-            auto tractorId = mRegistry.create();
-            auto tractorRenderable = sf::CircleShape(TRACTOR_RADIUS, 256);
-
-            helpers::centerOrigin(tractorRenderable, tractorRenderable.getLocalBounds());
-            tractorRenderable.setFillColor(sf::Color::Transparent);
-            tractorRenderable.setOutlineThickness(1.0f);
-            tractorRenderable.setOutlineColor(sf::Color(100, 150, 250, 80));
-            mRegistry.assign<Hidden>(tractorId);
-            mRegistry.assign<Tractor>(tractorId);
-            mRegistry.assign<HitRadius>(tractorId, TRACTOR_RADIUS);
-            mRegistry.assign<Renderable>(tractorId, std::move(tractorRenderable));
-
-            const auto playerId = mRegistry.create(sourcePlayerId, message.registry);
-            mRegistry.assign<EntityRef<Tractor>>(playerId, tractorId);
-            mRegistry.assign<EntityRef<Player>>(tractorId, playerId);
+            const auto windowWidth = message.viewport.width, windowHeight = message.viewport.height;
+            const auto playerId = initializePlayer();
+
+            migration::migrate(message.registry, sourcePlayerId, mRegistry, playerId, static_cast<PlayerComponents *>(nullptr));
+            mRegistry.assign_or_replace<Hidden>(*mRegistry.get<EntityRef<Tractor>>(playerId));
 
             auto &playerRenderable = mRegistry.get<Renderable>(playerId);
-            playerRenderable->setRotation(90.0f);
-            playerRenderable->setPosition(windowWidth / 2.0f, windowHeight / 4.0f);
+            playerRenderable.setRotation(90.0f);
+            playerRenderable.setPosition(windowWidth / 2.0f, windowHeight / 4.0f);
         }
     }
 }
 
 void PlanetAssault::initializePubSub() const noexcept {
+    pubsub::subscribe<messages::PlanetApproached>(*this);
     pubsub::subscribe<messages::PlanetEntered>(*this);
 }
 
@@ -156,167 +438,109 @@ void PlanetAssault::initializeGroups() noexcept {
     mRegistry.group<Supply<Energy>>(entt::get < Renderable, HitRadius > );
     mRegistry.group<Supply<Health>>(entt::get < Renderable, HitRadius > );
 
-    // AISystem
-    mRegistry.group<AI1>(entt::get < Renderable, HitRadius, ReloadTime > );
-    mRegistry.group<AI2>(entt::get < Renderable, HitRadius, ReloadTime > );
+    // every other pool the systems look at, so that they never add one to the registry while running side by side
+    mRegistry.view<Energy, ReloadTime, Score, Dirty, Bunker, AI1, AI2, EntityRef<Tractor>>();
 }
 
-void PlanetAssault::initializeReport(Assets &assets) noexcept {
-    mReport.setCharacterSize(18);
-    mReport.setFillColor(sf::Color(105, 235, 245, 255));
-    mReport.setFont(assets.getFontsManager().get(FontId::Mechanical));
+void PlanetAssault::initializeReport() noexcept {
+    mReport.characterSize = 18u;
+    mReport.color = sf::Color(105, 235, 245, 255);
+    mReport.fontId = FontId::Mechanical;
 }
 
-void PlanetAssault::initializeTerrain(const sf::RenderWindow &window, Assets &assets, const sf::Color terrainColor) noexcept {
-    const auto halfWindowHeight = window.getSize().y / 2.0f;
-    const auto viewport = sf::FloatRect(window.getViewport(window.getView()));
+void PlanetAssault::initializeTerrain(const sf::FloatRect &viewport, const Layout &layout, Assets &assets, const sf::Color terrainColor) noexcept {
+    auto &prefabsManager = assets.getPrefabsManager();
+    const auto spawnsCount = layout.AI1Bunkers.transforms.size() + layout.AI2Bunkers.transforms.size() +
+                             layout.energySupplies.transforms.size() + layout.healthSupplies.transforms.size();
 
-    const auto _terrainFrame = assets.getSpriteSheetsManager().get(SpriteSheetId::Terrain).getBuffer().at(0);
-    const auto terrainHitDiameter = std::max(_terrainFrame.width, _terrainFrame.height);
-    const auto terrainHitRadius = terrainHitDiameter / 2.0f;
-    auto rotationDistribution = FloatDistribution(-32.0f, 32.0f);
-    auto terrainPosition = sf::Vector2f(
-            0.0f,
-            FloatDistribution(halfWindowHeight * 1.5f + terrainHitDiameter, halfWindowHeight * 2.0f - terrainHitDiameter)(mRandomEngine)
-    );
+    // the layout tells exactly how many entities are about to be created: pools are sized once and never grow
+    mRegistry.reserve(mRegistry.size() + layout.terrain.size() + spawnsCount);
+    mRegistry.reserve<Terrain>(layout.terrain.size());
+    mRegistry.reserve<HitRadius>(layout.terrain.size() + spawnsCount);
+    mRegistry.reserve<Renderable>(layout.terrain.size() + spawnsCount);
 
-    do {
-        const auto terrainRotation = rotationDistribution(mRandomEngine);
+    auto entities = std::vector<entt::entity>(layout.terrain.size());
+    prefabsManager.instantiate(mRegistry, PrefabId::Terrain, layout.terrain.data(), layout.terrain.size(), entities.data());
 
-        for (auto i = 0u; i < TERRAIN_SEGMENTS_PER_UNIT; i++) {
-            auto terrainId = mRegistry.create();
-            auto terrainRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Terrain).instanceSprite(0);
-            const auto terrainBounds = terrainRenderable.getLocalBounds();
-            const auto terrainOffset = helpers::makeVector2(terrainRotation, terrainHitRadius);
+    for (const auto terrainId : entities) {
+        mRegistry.get<Renderable>(terrainId).setColor(terrainColor);
+    }
 
-            helpers::centerOrigin(terrainRenderable, terrainBounds);
+    const auto spawn = [&](const PrefabId prefabId, const Layout::Spawns &spawns, auto &&f) {
+        entities.resize(spawns.transforms.size());
+        prefabsManager.instantiate(mRegistry, prefabId, spawns.transforms.data(), spawns.transforms.size(), entities.data());
 
-            terrainPosition += terrainOffset;
-            terrainRenderable.setColor(terrainColor);
-            terrainRenderable.setPosition(terrainPosition);
-            terrainRenderable.setRotation(terrainRotation);
-            terrainPosition += terrainOffset;
+        for (auto i = std::size_t{0}; i < entities.size(); i++) {
+            f(entities[i], spawns.values[i]);
+        }
+    };
+
+    // bunkers are loaded from the start, they shoot on the first tick
+    const auto load = [this](const auto bunkerId, const auto reloadTime) {
+        mRegistry.get<ReloadTime>(bunkerId) = ReloadTime(reloadTime);
+        mReloads.schedule(bunkerId, sf::Time::Zero);
+    };
+
+    spawn(PrefabId::AI1Bunker, layout.AI1Bunkers, load);
+    spawn(PrefabId::AI2Bunker, layout.AI2Bunkers, load);
+    spawn(PrefabId::EnergySupply, layout.energySupplies, [this](const auto supplyId, const auto energy) { mRegistry.get<Supply<Energy>>(supplyId) = Supply<Energy>(energy); });
+    spawn(PrefabId::HealthSupply, layout.healthSupplies, [](const auto, const auto) {});
 
-            mRegistry.assign<Terrain>(terrainId);
-            mRegistry.assign<HitRadius>(terrainId, terrainHitRadius);
-            mRegistry.assign<Renderable>(terrainId, std::move(terrainRenderable));
+    mRegistry.view<Bunker, Renderable>().each([&](const auto bunkerId, const auto, const auto &bunkerRenderable) {
+        if (not viewport.contains(bunkerRenderable.getPosition())) {
+            mRegistry.destroy(bunkerId);
         }
-    } while (viewport.contains(terrainPosition));
+    });
 
-    auto AI1ReloadDistribution = FloatDistribution(1.64f, 2.28f);
-    auto AI2ReloadDistribution = FloatDistribution(1.96f, 2.28f);
-    auto energySupplyDistribution = FloatDistribution(2000.0f, 4000.0f);
-    auto entityDistribution = IntDistribution(1, 16);
+    mBonus += SCORE_PER_AI1 * std::distance(mRegistry.view<AI1>().begin(), mRegistry.view<AI1>().end());
+    mBonus += SCORE_PER_AI2 * std::distance(mRegistry.view<AI2>().begin(), mRegistry.view<AI2>().end());
+}
 
-    const auto terrain = mRegistry.view<Terrain, Renderable>();
-    for (auto terrainCursor = terrain.begin(); terrainCursor != terrain.end(); std::advance(terrainCursor, TERRAIN_SEGMENTS_PER_UNIT)) {
-        const auto &terrainRenderable = terrain.get<Renderable>(*terrainCursor);
-        const auto position = terrainRenderable->getPosition() +
-                              helpers::makeVector2(terrainRenderable->getRotation() + 180.0f, terrainHitRadius * (TERRAIN_SEGMENTS_PER_UNIT - 1u));
+entt::entity PlanetAssault::initializePlayer() noexcept {
+    // the player and its tractor are created on the first landing and kept afterwards, landing again only moves the
+    // state of the player over the one left by the previous visit
+    if (const auto players = mRegistry.view<Player>(); players.begin() != players.end()) {
+        return *players.begin();
+    }
 
-        switch (entityDistribution(mRandomEngine)) {
-            case 2:
-            case 16: {
-                auto bunkerId = mRegistry.create();
-                auto bunkerRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Bunker).instanceSprite(0);
-                const auto bunkerBounds = bunkerRenderable.getLocalBounds();
-                const auto bunkerHitRadius = std::max(bunkerBounds.width, bunkerBounds.height) / 2.0f;
-
-                helpers::centerOrigin(bunkerRenderable, bunkerBounds);
-                bunkerRenderable.setRotation(terrainRenderable->getRotation() + 180.0f);
-                bunkerRenderable.setPosition(position + helpers::makeVector2(terrainRenderable->getRotation() + 270.0f, bunkerHitRadius));
-
-                mRegistry.assign<AI1>(bunkerId);
-                mRegistry.assign<Bunker>(bunkerId);
-                mRegistry.assign<Damage>(bunkerId, 2);
-                mRegistry.assign<Health>(bunkerId, 1);
-                mRegistry.assign<ReloadTime>(bunkerId, AI1ReloadDistribution(mRandomEngine));
-                mRegistry.assign<HitRadius>(bunkerId, bunkerHitRadius);
-                mRegistry.assign<Renderable>(bunkerId, std::move(bunkerRenderable));
-            }
-                break;
+    const auto playerId = mRegistry.create();
+    const auto tractorId = mRegistry.create();
 
-            case 8: {
-                auto bunkerId = mRegistry.create();
-                auto bunkerRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Bunker).instanceSprite(1);
-                const auto bunkerBounds = bunkerRenderable.getLocalBounds();
-                const auto bunkerHitRadius = std::max(bunkerBounds.width, bunkerBounds.height) / 2.0f;
-
-                helpers::centerOrigin(bunkerRenderable, bunkerBounds);
-                bunkerRenderable.setRotation(terrainRenderable->getRotation() + 180.0f);
-                bunkerRenderable.setPosition(position + helpers::makeVector2(terrainRenderable->getRotation() + 270.0f, bunkerHitRadius));
-
-                mRegistry.assign<AI2>(bunkerId);
-                mRegistry.assign<Bunker>(bunkerId);
-                mRegistry.assign<Damage>(bunkerId, 3);
-                mRegistry.assign<Health>(bunkerId, 2);
-                mRegistry.assign<ReloadTime>(bunkerId, AI2ReloadDistribution(mRandomEngine));
-                mRegistry.assign<HitRadius>(bunkerId, bunkerHitRadius);
-                mRegistry.assign<Renderable>(bunkerId, std::move(bunkerRenderable));
-            }
-                break;
+    mRegistry.assign<Hidden>(tractorId);
+    mRegistry.assign<Tractor>(tractorId);
+    mRegistry.assign<HitRadius>(tractorId, TRACTOR_RADIUS);
+    mRegistry.assign<Renderable>(tractorId, Renderable::ring(TRACTOR_RADIUS, sf::Color(100, 150, 250, 80)));
+    mRegistry.assign<EntityRef<Player>>(tractorId, playerId);
 
-            case 4: {
-                auto supplyId = mRegistry.create();
-                auto supplyRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Supply).instanceSprite(1);
-                const auto supplyBounds = supplyRenderable.getLocalBounds();
-                const auto supplyHitRadius = std::max(supplyBounds.width, supplyBounds.height) / 2.0f;
-
-                helpers::centerOrigin(supplyRenderable, supplyBounds);
-                supplyRenderable.setRotation(terrainRenderable->getRotation() + 180.0f);
-                supplyRenderable.setPosition(position + helpers::makeVector2(terrainRenderable->getRotation() + 270.0f, supplyHitRadius));
-
-                mRegistry.assign<Damage>(supplyId, 1);
-                mRegistry.assign<Health>(supplyId, 1);
-                mRegistry.assign<HitRadius>(supplyId, supplyHitRadius);
-                mRegistry.assign<Renderable>(supplyId, std::move(supplyRenderable));
-                mRegistry.assign<Supply<Energy>>(supplyId, energySupplyDistribution(mRandomEngine));
-            }
-                break;
+    mRegistry.assign<Player>(playerId);
+    mRegistry.assign<EntityRef<Tractor>>(playerId, tractorId);
 
-            case 6:
-            case 12: {
-                auto supplyId = mRegistry.create();
-                auto supplyRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Supply).instanceSprite(0);
-                const auto supplyBounds = supplyRenderable.getLocalBounds();
-                const auto supplyHitRadius = std::max(supplyBounds.width, supplyBounds.height) / 2.0f;
-
-                helpers::centerOrigin(supplyRenderable, supplyBounds);
-                supplyRenderable.setRotation(terrainRenderable->getRotation() + 180.0f);
-                supplyRenderable.setPosition(position + helpers::makeVector2(terrainRenderable->getRotation() + 270.0f, supplyHitRadius));
-
-                mRegistry.assign<Damage>(supplyId, 1);
-                mRegistry.assign<Health>(supplyId, 1);
-                mRegistry.assign<HitRadius>(supplyId, supplyHitRadius);
-                mRegistry.assign<Renderable>(supplyId, std::move(supplyRenderable));
-                mRegistry.assign<Supply<Health>>(supplyId, 1);
-            }
-                break;
+    return playerId;
+}
 
-            default:
-                break;
-        }
-    }
+void PlanetAssault::generateTerrain(const sf::FloatRect &viewport, Assets &assets) noexcept {
+    if (not mTerrainGenerated) {
+        auto layout = mLayout.valid() ? mLayout.get() : generateLayout(viewport, assets);
 
-    mRegistry.view<Bunker, Renderable>().each([&](const auto bunkerId, const auto, const auto &bunkerRenderable) {
-        if (not viewport.contains(bunkerRenderable->getPosition())) {
-            mRegistry.destroy(bunkerId);
+        if (layout.viewport != viewport) { // prefetched before the window changed size
+            layout = generateLayout(viewport, assets);
         }
-    });
 
-    mBonus += SCORE_PER_AI1 * std::distance(mRegistry.view<AI1>().begin(), mRegistry.view<AI1>().end());
-    mBonus += SCORE_PER_AI2 * std::distance(mRegistry.view<AI2>().begin(), mRegistry.view<AI2>().end());
+        initializeTerrain(viewport, layout, assets, mTerrainColor);
+        mTerrainGenerated = true;
+    }
 }
 
-void PlanetAssault::inputSystem(Assets &assets, const sf::Time elapsed) noexcept {
+void PlanetAssault::inputSystem(const Input &input, const sf::Time elapsed) noexcept {
     using Key = sf::Keyboard::Key;
-    const auto isKeyPressed = &sf::Keyboard::isKeyPressed;
+    const auto isKeyPressed = [&input](const Key key) { return input.isKeyPressed(key); };
+    auto registry = CheckedRegistry(mRegistry);
 
-    mRegistry
-            .view<Player, HitRadius, Renderable, Energy, Velocity, ReloadTime>()
+    registry
+            .view<const Player, const HitRadius, Renderable, Energy, Velocity, ReloadTime>()
             .each([&](const auto playerId, const auto, const auto &playerHitRadius, auto &playerRenderable,
                       auto &playerEnergy, auto &playerVelocity, auto &playerReloadTime) {
-                const auto tractorId = *mRegistry.get<EntityRef<Tractor>>(playerId);
+                const auto tractorId = *registry.get<const EntityRef<Tractor>>(playerId);
                 auto playerSpeed = PLAYER_SPEED;
 
                 if (isKeyPressed(Key::W)) {
@@ -326,140 +550,140 @@ void PlanetAssault::inputSystem(Assets &assets, const sf::Time elapsed) noexcept
                 }
 
                 if (isKeyPressed(Key::A)) {
-                    playerRenderable->rotate(-PLAYER_ROTATION_SPEED * elapsed.asSeconds());
+                    playerRenderable.rotate(-PLAYER_ROTATION_SPEED * elapsed.asSeconds());
                 }
 
                 if (isKeyPressed(Key::D)) {
-                    playerRenderable->rotate(PLAYER_ROTATION_SPEED * elapsed.asSeconds());
+                    playerRenderable.rotate(PLAYER_ROTATION_SPEED * elapsed.asSeconds());
                 }
 
-                playerVelocity.value = helpers::makeVector2(playerRenderable->getRotation(), playerSpeed);
+                playerVelocity.value = helpers::makeVector2(playerRenderable.getRotation(), playerSpeed);
                 playerEnergy.consume(playerSpeed * elapsed.asSeconds());
+                registry.assign_or_replace<Dirty>(playerId);
 
                 if (isKeyPressed(Key::RShift)) {
-                    mRegistry.get<Renderable>(tractorId)->setPosition(playerRenderable->getPosition());
-                    mRegistry.reset<Hidden>(tractorId);
+                    registry.get<Renderable>(tractorId).setPosition(playerRenderable.getPosition());
+                    registry.reset<Hidden>(tractorId);
                 } else {
-                    mRegistry.assign_or_replace<Hidden>(tractorId);
+                    registry.assign_or_replace<Hidden>(tractorId);
 
                     if (playerReloadTime.canShoot() and isKeyPressed(Key::Space)) {
-                        const auto bulletRotation = playerRenderable->getRotation();
-                        const auto bulletPosition = playerRenderable->getPosition() + helpers::makeVector2(bulletRotation, 1.0f + *playerHitRadius);
+                        const auto bulletRotation = playerRenderable.getRotation();
+                        const auto bulletPosition = playerRenderable.getPosition() + helpers::makeVector2(bulletRotation, 1.0f + *playerHitRadius);
                         playerReloadTime.reset();
-                        // NOTE for a future me: be aware that this invalidates some component references !!!
-                        shoot(mRegistry, assets, bulletPosition, bulletRotation);
+                        mCommands.shots.push_back(Commands::Shot{bulletPosition, bulletRotation});
                     }
                 }
             });
 }
 
 void PlanetAssault::motionSystem(const sf::Time elapsed) noexcept {
-    mRegistry.group<Velocity>(entt::get < Renderable > ).each([&](const auto &velocity, auto &renderable) {
-        renderable->move(velocity.value * elapsed.asSeconds());
+    CheckedRegistry(mRegistry).group<const Velocity>(entt::get < Renderable > ).each([&](const auto &velocity, auto &renderable) {
+        renderable.move(velocity.value * elapsed.asSeconds());
     });
 }
 
-void PlanetAssault::collisionSystem(const sf::RenderWindow &window, Assets &assets, const sf::Time elapsed) noexcept {
-    const auto viewport = sf::FloatRect(window.getViewport(window.getView()));
+void PlanetAssault::collisionSystem(const sf::FloatRect &viewport, Assets &assets, const sf::Time elapsed) noexcept {
     auto solarSystemExited = false;
     auto isTractorActive = false;
+    auto registry = CheckedRegistry(mRegistry);
 
     // general entities collisions
-    const auto g1 = mRegistry.group<Health>(entt::get < Renderable, HitRadius > );
-    const auto g2 = mRegistry.group<Damage>(entt::get < Renderable, HitRadius > );
+    const auto g1 = registry.group<const Health>(entt::get < const Renderable, const HitRadius > );
+    const auto g2 = registry.group<const Damage>(entt::get < const Renderable, const HitRadius > );
     for (auto e1 : g1) {
         for (auto e2 : g2) {
             if (e1 != e2) {
-                const auto &[entityRenderable1, entityHitRadius1] = g1.get<Renderable, HitRadius>(e1);
-                const auto &[entityRenderable2, entityHitRadius2] = g2.get<Renderable, HitRadius>(e2);
+                const auto &[entityRenderable1, entityHitRadius1] = g1.get<const Renderable, const HitRadius>(e1);
+                const auto &[entityRenderable2, entityHitRadius2] = g2.get<const Renderable, const HitRadius>(e2);
 
-                if (helpers::magnitude(entityRenderable1->getPosition(), entityRenderable2->getPosition()) <= *entityHitRadius1 + *entityHitRadius2) {
+                if (helpers::magnitude(entityRenderable1.getPosition(), entityRenderable2.getPosition()) <= *entityHitRadius1 + *entityHitRadius2) {
                     assets.getAudioManager().play(SoundId::Hit);
-                    g1.get<Health>(e1).harm(g2.get<Damage>(e2));
+                    harm(registry, e1, g2.get<const Damage>(e2));
                 }
             }
         }
     }
 
     // tractor hits supply
-    mRegistry
-            .group<Tractor>(entt::get < Renderable, HitRadius, EntityRef<Player>> , entt::exclude < Hidden > )
+    registry
+            .group<const Tractor>(entt::get < const Renderable, const HitRadius, const EntityRef<Player>> , entt::exclude < Hidden > )
             .each([&](const auto, const auto &tractorRenderable, const auto &tractorHitRadius, const auto &playerRef) {
                 const auto playerId = *playerRef;
 
-                mRegistry
-                        .group<Bullet>(entt::get < Renderable, HitRadius, Velocity > )
+                registry
+                        .group<const Bullet>(entt::get < Renderable, const HitRadius, Velocity > )
                         .each([&](const auto, auto &bulletRenderable, const auto &bulletHitRadius, auto &velocity) {
-                            if (helpers::magnitude(tractorRenderable->getPosition(), bulletRenderable->getPosition()) <= *tractorHitRadius + *bulletHitRadius) {
+                            if (helpers::magnitude(tractorRenderable.getPosition(), bulletRenderable.getPosition()) <= *tractorHitRadius + *bulletHitRadius) {
                                 const auto rotationDiff = helpers::shortestRotation(
-                                        bulletRenderable->getRotation(),
-                                        helpers::rotation(bulletRenderable->getPosition(), tractorRenderable->getPosition())
+                                        bulletRenderable.getRotation(),
+                                        helpers::rotation(bulletRenderable.getPosition(), tractorRenderable.getPosition())
                                 );
 
-                                bulletRenderable->rotate(helpers::signum(rotationDiff) * 220.0f * elapsed.asSeconds());
-                                velocity.value = helpers::makeVector2(bulletRenderable->getRotation(), BULLET_SPEED);
+                                bulletRenderable.rotate(helpers::signum(rotationDiff) * 220.0f * elapsed.asSeconds());
+                                velocity.value = helpers::makeVector2(bulletRenderable.getRotation(), BULLET_SPEED);
                             }
                         });
 
-                mRegistry
-                        .group<Supply<Energy>>(entt::get < Renderable, HitRadius > )
+                registry
+                        .group<const Supply<Energy>>(entt::get < const Renderable, const HitRadius > )
                         .each([&](const auto supplyId, const auto &supply, const auto &supplyRenderable, const auto &supplyHitRadius) {
-                            if (helpers::magnitude(tractorRenderable->getPosition(), supplyRenderable->getPosition()) <= *tractorHitRadius + *supplyHitRadius) {
-                                mRegistry.get<Health>(supplyId).kill();
-                                mRegistry.get<Energy>(playerId).recharge(supply);
+                            if (helpers::magnitude(tractorRenderable.getPosition(), supplyRenderable.getPosition()) <= *tractorHitRadius + *supplyHitRadius) {
+                                kill(registry, supplyId);
+                                registry.get<Energy>(playerId).recharge(supply);
                                 isTractorActive = true;
                             }
                         });
 
-                mRegistry
-                        .group<Supply<Health>>(entt::get < Renderable, HitRadius > )
+                registry
+                        .group<const Supply<Health>>(entt::get < const Renderable, const HitRadius > )
                         .each([&](const auto supplyId, const auto &supply, const auto &supplyRenderable, const auto &supplyHitRadius) {
-                            if (helpers::magnitude(tractorRenderable->getPosition(), supplyRenderable->getPosition()) <= *tractorHitRadius + *supplyHitRadius) {
-                                mRegistry.get<Health>(supplyId).kill();
-                                mRegistry.get<Health>(playerId).heal(supply);
+                            if (helpers::magnitude(tractorRenderable.getPosition(), supplyRenderable.getPosition()) <= *tractorHitRadius + *supplyHitRadius) {
+                                kill(registry, supplyId);
+                                registry.get<Health>(playerId).heal(supply);
                                 isTractorActive = true;
                             }
                         });
             });
 
     // bullet exits screen / bullet hits terrain
-    mRegistry
-            .view<Bullet, Renderable, HitRadius>()
+    registry
+            .view<const Bullet, const Renderable, const HitRadius>()
             .each([&](const auto bulletId, const auto, const auto &bulletRenderable, const auto &bulletHitRadius) {
-                if (viewport.contains(bulletRenderable->getPosition())) {
-                    const auto terrains = mRegistry.group<Terrain>(entt::get < Renderable, HitRadius > );
+                if (viewport.contains(bulletRenderable.getPosition())) {
+                    const auto terrains = registry.group<const Terrain>(entt::get < const Renderable, const HitRadius > );
 
                     for (const auto terrainId : terrains) {
-                        const auto &[terrainRenderable, terrainHitRadius] = terrains.get<Renderable, HitRadius>(terrainId);
-                        if (helpers::magnitude(terrainRenderable->getPosition(), bulletRenderable->getPosition()) <= *terrainHitRadius + *bulletHitRadius) {
-                            mRegistry.get<Health>(bulletId).kill();
+                        const auto &[terrainRenderable, terrainHitRadius] = terrains.template get<const Renderable, const HitRadius>(terrainId);
+                        if (helpers::magnitude(terrainRenderable.getPosition(), bulletRenderable.getPosition()) <= *terrainHitRadius + *bulletHitRadius) {
+                            kill(registry, bulletId);
                             break;
                         }
                     }
                 } else {
-                    mRegistry.get<Health>(bulletId).kill();
+                    kill(registry, bulletId);
                 }
             });
 
     // player exits screen / player hits terrain
-    mRegistry
-            .group<Player>(entt::get < Renderable, HitRadius > )
+    registry
+            .group<const Player>(entt::get < Renderable, const HitRadius > )
             .each([&](const auto playerId, const auto, auto &playerRenderable, const auto &playerHitRadius) {
-                if (viewport.contains(playerRenderable->getPosition())) {
-                    const auto terrains = mRegistry.group<Terrain>(entt::get < Renderable, HitRadius > );
+                if (viewport.contains(playerRenderable.getPosition())) {
+                    const auto terrains = registry.group<const Terrain>(entt::get < const Renderable, const HitRadius > );
 
                     for (const auto terrainId : terrains) {
-                        const auto &[terrainRenderable, terrainHitRadius] = terrains.get<Renderable, HitRadius>(terrainId);
-                        if (helpers::magnitude(terrainRenderable->getPosition(), playerRenderable->getPosition()) <= *terrainHitRadius + *playerHitRadius) {
+                        const auto &[terrainRenderable, terrainHitRadius] = terrains.template get<const Renderable, const HitRadius>(terrainId);
+                        if (helpers::magnitude(terrainRenderable.getPosition(), playerRenderable.getPosition()) <= *terrainHitRadius + *playerHitRadius) {
                             assets.getAudioManager().play(SoundId::Explosion);
-                            mRegistry.get<Health>(playerId).harm(Damage(1));
-                            playerRenderable->setPosition({viewport.width / 2.0f, viewport.height / 4.0f});
+                            harm(registry, playerId, Damage(1));
+                            playerRenderable.setPosition({viewport.width / 2.0f, viewport.height / 4.0f});
                             break;
                         }
                     }
                 } else {
                     solarSystemExited = true;
-                    playerRenderable->setPosition({viewport.width / 2.0f, viewport.height / 4.0f});
+                    playerRenderable.setPosition({viewport.width / 2.0f, viewport.height / 4.0f});
                 }
             });
 
@@ -468,113 +692,125 @@ void PlanetAssault::collisionSystem(const sf::RenderWindow &window, Assets &asse
     }
 
     if (solarSystemExited) {
-        const auto bullets = mRegistry.view<Bullet>();
-        mRegistry.destroy(bullets.begin(), bullets.end());
         mNextSceneId = mSolarSystemSceneId;
-        pubsub::publish<SolarSystemEntered>(window, mRegistry, getSceneId(), mBonus);
+        mCommands.solarSystemExited = true;
     }
 }
 
 void PlanetAssault::reloadSystem(sf::Time elapsed) noexcept {
-    mRegistry.view<ReloadTime>().each([&](auto &reloadTime) {
+    // bunkers wait on the reload timers, only the player reloads a frame at a time
+    mReloads.advance(elapsed);
+
+    CheckedRegistry(mRegistry).view<const Player, ReloadTime>().each([&](const auto, auto &reloadTime) {
         reloadTime.elapse(elapsed);
     });
 }
 
-void PlanetAssault::AISystem(Assets &assets) noexcept {
-    auto AI1Precision = FloatDistribution(-16.0f, 16.0f);
-    auto AI2Precision = FloatDistribution(-8.0f, 8.0f);
-
-    mRegistry.view<Player, Renderable>().each([&](const auto, const auto playerRenderable) {
-        mRegistry
-                .group<AI1>(entt::get < Renderable, HitRadius, ReloadTime > )
-                .each([&](const auto, const auto &AIRenderable, const auto &AIHitRadius, auto &AIReloadTime) {
-                    if (AIReloadTime.canShoot()) {
-                        const auto bulletRotation = helpers::rotation(AIRenderable->getPosition(), playerRenderable->getPosition()) +
-                                                    AI1Precision(mRandomEngine);
-                        const auto bulletPosition = AIRenderable->getPosition() + helpers::makeVector2(bulletRotation, *AIHitRadius + 1.0f);
-                        AIReloadTime.reset();
-                        shoot(mRegistry, assets, bulletPosition, bulletRotation);
-                    }
-                });
-
-        mRegistry
-                .group<AI2>(entt::get < Renderable, HitRadius, ReloadTime > )
-                .each([&](const auto, const auto &AIRenderable, const auto &AIHitRadius, auto &AIReloadTime) {
-                    if (AIReloadTime.canShoot()) {
-                        const auto bulletRotation = helpers::rotation(AIRenderable->getPosition(), playerRenderable->getPosition()) +
-                                                    AI2Precision(mRandomEngine);
-                        const auto bulletPosition = AIRenderable->getPosition() + helpers::makeVector2(bulletRotation, *AIHitRadius + 1.0f);
-                        AIReloadTime.reset();
-                        shoot(mRegistry, assets, bulletPosition, bulletRotation);
-                    }
-                });
+void PlanetAssault::AISystem() noexcept {
+    auto registry = CheckedRegistry(mRegistry);
+
+    registry.view<const Player, const Renderable>().each([&](const auto, const auto &playerRenderable) {
+        // only the bunkers done reloading are visited, the destroyed ones are simply dropped
+        mReloads.expire([&](const auto AIId) {
+            if (registry.valid(AIId)) {
+                const auto &[AIRenderable, AIHitRadius, AIReloadTime] = registry.get<const Renderable, const HitRadius, const ReloadTime>(AIId);
+                auto &AIPrecision = registry.has<AI1>(AIId) ? mAI1Precision : mAI2Precision;
+                const auto bulletRotation = helpers::rotation(AIRenderable.getPosition(), playerRenderable.getPosition()) +
+                                            AIPrecision(mAIRandomEngine);
+                const auto bulletPosition = AIRenderable.getPosition() + helpers::makeVector2(bulletRotation, *AIHitRadius + 1.0f);
+
+                mReloads.schedule(AIId, sf::seconds(AIReloadTime.getSecondsBeforeShoot()));
+                mCommands.shots.push_back(Commands::Shot{bulletPosition, bulletRotation});
+            }
+        });
     });
 }
 
-void PlanetAssault::livenessSystem(Assets &assets) noexcept {
-    const auto players = mRegistry.view<Player, Health, Energy>();
-    auto entitiesToDestroy = std::vector<entt::entity>();
+void PlanetAssault::livenessSystem(Assets &assets, FrameArena &frameArena) noexcept {
+    auto registry = CheckedRegistry(mRegistry);
+    const auto players = registry.view<const Player, const Health, const Energy>();
+    const auto dirty = registry.view<const Dirty>();
+    auto entitiesToDestroy = std::pmr::vector<entt::entity>(&frameArena);
 
-    mRegistry.view<Health>().each([&](const auto id, const auto &health) {
-        if (health.isOver()) {
-            entitiesToDestroy.push_back(id);
-            if (mRegistry.has<Player>(id) or mRegistry.has<Bunker>(id)) {
-                assets.getAudioManager().play(SoundId::Explosion);
-            }
+    // health and energy only drop where they are marked dirty, the other entities are as alive as they were
+    for (const auto id : dirty) {
+        const auto health = registry.try_get<const Health>(id);
+        const auto energy = registry.try_get<const Energy>(id);
+        const auto isHealthOver = health and health->isOver();
+
+        if (isHealthOver and (registry.has<Player>(id) or registry.has<Bunker>(id))) {
+            assets.getAudioManager().play(SoundId::Explosion);
         }
-    });
 
-    mRegistry.view<Energy>().each([&](const auto id, const auto &energy) {
-        if (energy.isOver()) {
+        if (isHealthOver or (energy and energy->isOver())) {
             entitiesToDestroy.push_back(id);
         }
-    });
+    }
 
     for (const auto id : players) {
-        const auto &[health, energy] = players.get<Health, Energy>(id);
+        const auto &[health, energy] = players.get<const Health, const Energy>(id);
         if (health.isOver() or energy.isOver()) {
             mNextSceneId = mLeaderBoardSceneId;
-            pubsub::publish<GameOver>(mRegistry.get<Score>(id).value);
+            pubsub::publish<GameOver>(registry.get<const Score>(id).value);
             return;
         }
     }
 
-    mRegistry.destroy(entitiesToDestroy.begin(), entitiesToDestroy.end());
+    mCommands.destroyed.insert(mCommands.destroyed.end(), entitiesToDestroy.begin(), entitiesToDestroy.end());
+
+    // one by one rather than resetting the pool, which would release its memory to allocate it again next tick
+    for (const auto id : dirty) {
+        registry.remove<Dirty>(id);
+    }
 }
 
-void PlanetAssault::reportSystem(const sf::RenderWindow &window) noexcept {
-    mRegistry.view<Player, Health, Energy, Score>().each([&](const auto, const auto &health, const auto &energy, const auto &score) {
+void PlanetAssault::reportSystem(const sf::FloatRect &viewport) noexcept {
+    CheckedRegistry(mRegistry).view<const Player, const Health, const Energy, const Score>().each([&](const auto, const auto &health, const auto &energy, const auto &score) {
         std::snprintf(
-                mBuffer, std::size(mBuffer),
+                mReport.string.data(), mReport.string.size(),
                 "health: %02d energy: %05.0f score: %05u",
                 health.getValue(), energy.getValue(), score.value
         );
-        helpers::centerOrigin(mReport, mReport.getLocalBounds());
-
-        mReport.setString(mBuffer);
-        mReport.setPosition(window.getSize().x / 2.0f, 18.0f);
+        mReport.position = sf::Vector2f(viewport.width / 2.0f, 18.0f);
     });
 }
 
-void shoot(entt::registry &registry, Assets &assets, const sf::Vector2f &position, const float rotation) noexcept {
-    auto bulletRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::Bullet).instanceSprite(0);
-    const auto bulletBounds = bulletRenderable.getLocalBounds();
-    const auto bulletId = registry.create();
-    static const auto bulletHitRadius = std::max(bulletBounds.width, bulletBounds.height) / 2.0f;
+void PlanetAssault::commandSystem(const sf::FloatRect &viewport, Assets &assets) noexcept {
+    auto &registry = CheckedRegistry(mRegistry).unchecked();
 
-    helpers::centerOrigin(bulletRenderable, bulletBounds);
-    bulletRenderable.setRotation(rotation);
-    bulletRenderable.setPosition(position);
+    for (const auto &shot : mCommands.shots) {
+        shoot(registry, assets, shot.position, shot.rotation);
+    }
 
-    registry.assign<Bullet>(bulletId);
-    registry.assign<Health>(bulletId, 1);
-    registry.assign<Damage>(bulletId, 1);
-    registry.assign<HitRadius>(bulletId, bulletHitRadius);
-    registry.assign<Renderable>(bulletId, std::move(bulletRenderable));
-    registry.assign<Velocity>(bulletId, helpers::makeVector2(rotation, BULLET_SPEED));
+    registry.destroy(mCommands.destroyed.begin(), mCommands.destroyed.end());
+
+    // a player dying on the way out goes to the leader board instead
+    if (mCommands.solarSystemExited and mSolarSystemSceneId == mNextSceneId) {
+        const auto bullets = registry.view<Bullet>();
+        registry.destroy(bullets.begin(), bullets.end());
+        pubsub::publish<SolarSystemEntered>(viewport, registry, getSceneId(), mBonus);
+    }
+
+    mCommands.shots.clear();
+    mCommands.destroyed.clear();
+    mCommands.solarSystemExited = false;
+}
+
+void PlanetAssault::shoot(entt::registry &registry, Assets &assets, const sf::Vector2f &position, const float rotation) noexcept {
+    const auto bulletId = assets.getPrefabsManager().instantiate(registry, PrefabId::Bullet, Transform{position, rotation});
+    registry.get<Velocity>(bulletId).value = helpers::makeVector2(rotation, BULLET_SPEED);
 
     assets.getAudioManager().play(SoundId::Shot);
 }
 
+void harm(CheckedRegistry &registry, const entt::entity entity, const Damage &damage) noexcept {
+    registry.get<Health>(entity).harm(damage);
+    registry.assign_or_replace<Dirty>(entity);
+}
+
+void kill(CheckedRegistry &registry, const entt::entity entity) noexcept {
+    registry.get<Health>(entity).kill();
+    registry.assign_or_replace<Dirty>(entity);
+}
+
 static_assert(TERRAIN_SEGMENTS_PER_UNIT >= 1u);
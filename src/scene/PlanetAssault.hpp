@@ -27,18 +27,66 @@
 
 #pragma once
 
+#include <vector>
+#include <future>
 #include <entt/entt.hpp>
 #include <Scene.hpp>
 #include <pubsub.hpp>
 #include <helpers.hpp>
+#include <TimerQueue.hpp>
 #include <messages.hpp>
+#include <RenderSnapshot.hpp>
+
+namespace nongravitar::bench {
+    class Probe;
+}
 
 namespace nongravitar::scene {
-    class PlanetAssault final : public Scene, public pubsub::Handler<messages::PlanetEntered> {
+    class PlanetAssault final : public Scene,
+                                public pubsub::Handler<messages::PlanetApproached>,
+                                public pubsub::Handler<messages::PlanetEntered> {
+        friend class bench::Probe;
+
     public:
+        /**
+         * Where the terrain segments, bunkers and supplies of a planet stand, together with the per-entity values
+         * (reload time of the bunkers, energy of the supplies) drawn while placing them.
+         *
+         * It's plain data built without touching the registry, therefore it can be generated in background while the
+         * player is still flying towards the planet.
+         */
+        struct Layout final {
+            struct Spawns final {
+                std::vector<assets::Transform> transforms;
+                std::vector<float> values;
+            };
+
+            sf::FloatRect viewport; // the one it was generated for
+            std::vector<assets::Transform> terrain;
+            Spawns AI1Bunkers;
+            Spawns AI2Bunkers;
+            Spawns energySupplies;
+            Spawns healthSupplies;
+        };
+
+        /**
+         * Structural changes asked by the systems during a tick, the command system applies them once the others are
+         * done so that no other system creates or destroys entities.
+         */
+        struct Commands final {
+            struct Shot final {
+                sf::Vector2f position;
+                float rotation;
+            };
+
+            std::vector<Shot> shots;
+            std::vector<entt::entity> destroyed;
+            bool solarSystemExited{false};
+        };
+
         PlanetAssault() = delete; // no default-constructible
 
-        PlanetAssault(SceneId solarSystemSceneId, SceneId leaderBoardSceneId);
+        PlanetAssault(SceneId solarSystemSceneId, SceneId leaderBoardSceneId, helpers::Seed seed);
 
         PlanetAssault(const PlanetAssault &) = delete; // no copy-constructible
         PlanetAssault &operator=(const PlanetAssault &) = delete; // no copy-assignable
@@ -51,35 +99,65 @@ namespace nongravitar::scene {
          *  This method should be called exactly once in the life-cycle of this object, any usage of this object
          *  without proper initialization will result in a error.
          */
-        PlanetAssault &initialize(const sf::RenderWindow &window, Assets &assets, sf::Color terrainColor) noexcept;
+        PlanetAssault &initialize(const sf::FloatRect &viewport, Assets &assets, sf::Color terrainColor) noexcept;
 
-        SceneId update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept final;
+        /**
+         * Draws the layout of the planet from a copy of the terrain random engine, so the same planet always gets the
+         * same layout and it's safe to call this method from a thread other than the one running the game.
+         */
+        [[nodiscard]] Layout generateLayout(const sf::FloatRect &viewport, const Assets &assets) const noexcept;
+
+        SceneId update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept final;
+
+        void render(RenderSnapshot &snapshot) const noexcept final;
+
+        [[nodiscard]] std::optional<Input> autopilot(const sf::FloatRect &viewport) const noexcept final;
 
-        void render(sf::RenderTarget &window) const noexcept final;
+        void save(OutputArchive &archive) const final;
+
+        void load(InputArchive &archive) final;
+
+        void hash(StateHash &hash) const noexcept final;
 
     private:
+        void operator()(const messages::PlanetApproached &message) noexcept final;
         void operator()(const messages::PlanetEntered &message) noexcept final;
 
         void initializePubSub() const noexcept;
         void initializeGroups() noexcept;
-        void initializeReport(Assets &assets) noexcept;
-        void initializeTerrain(const sf::RenderWindow &window, Assets &assets, sf::Color terrainColor) noexcept;
+        void initializeReport() noexcept;
+        void initializeTerrain(const sf::FloatRect &viewport, const Layout &layout, Assets &assets, sf::Color terrainColor) noexcept;
+        void generateTerrain(const sf::FloatRect &viewport, Assets &assets) noexcept;
+        entt::entity initializePlayer() noexcept;
+
+        /**
+         * Spawn a bullet, every bullet of the scene is created this way.
+         */
+        static void shoot(entt::registry &registry, Assets &assets, const sf::Vector2f &position, float rotation) noexcept;
 
-        void inputSystem(Assets &assets, sf::Time elapsed) noexcept;
+        void inputSystem(const Input &input, sf::Time elapsed) noexcept;
         void motionSystem(sf::Time elapsed) noexcept;
-        void collisionSystem(const sf::RenderWindow &window, Assets &assets, sf::Time elapsed) noexcept;
+        void collisionSystem(const sf::FloatRect &viewport, Assets &assets, sf::Time elapsed) noexcept;
         void reloadSystem(sf::Time elapsed) noexcept;
-        void AISystem(Assets &assets) noexcept;
-        void livenessSystem(Assets &assets) noexcept;
-        void reportSystem(const sf::RenderWindow &window) noexcept;
+        void AISystem() noexcept;
+        void livenessSystem(Assets &assets, FrameArena &frameArena) noexcept;
+        void reportSystem(const sf::FloatRect &viewport) noexcept;
+        void commandSystem(const sf::FloatRect &viewport, Assets &assets) noexcept;
 
         entt::registry mRegistry;
-        char mBuffer[56];
-        sf::Text mReport;
-        helpers::RandomEngine mRandomEngine;
+        Label mReport;
+        helpers::RandomEngine mTerrainRandomEngine;
+        helpers::RandomEngine mAIRandomEngine;
+        helpers::FloatDistribution mAI1Precision;
+        helpers::FloatDistribution mAI2Precision;
         const SceneId mLeaderBoardSceneId;
         const SceneId mSolarSystemSceneId;
         SceneId mNextSceneId = nullSceneId;
         unsigned mBonus{0u};
+        sf::Color mTerrainColor;
+        bool mTerrainGenerated{false};
+        TimerQueue mReloads; // bunkers waiting to shoot again
+        Commands mCommands; // empty between two ticks, capacity is kept
+        std::future<Layout> mLayout; // prefetched on PlanetApproached, it goes last so it's joined first on destruction
     };
 }
@@ -28,8 +28,13 @@
 #include <iostream>
 #include <tags.hpp>
 #include <trace.hpp>
+#include <Archive.hpp>
+#include <StateHash.hpp>
 #include <helpers.hpp>
+#include <allocations.hpp>
+#include <autopilot.hpp>
 #include <constants.hpp>
+#include <migration.hpp>
 #include <components.hpp>
 #include <scene/PlanetAssault.hpp>
 #include <scene/SolarSystem.hpp>
@@ -42,47 +47,48 @@ using namespace nongravitar::messages;
 using namespace nongravitar::constants;
 using namespace nongravitar::components;
 
-using helpers::RandomDevice;
-using helpers::RandomEngine;
+using helpers::Stream;
 using helpers::IntDistribution;
 using helpers::FloatDistribution;
 
 constexpr auto PLANET_MIN_RADIUS = 32.0f;
 constexpr auto PLANET_MAX_RADIUS = 64.0f;
 constexpr auto SPAWN_RADIUS = 64.0f;
+constexpr auto PLANET_PREFETCH_DISTANCE = 160.0f;
 
-SolarSystem::SolarSystem(const SceneId leaderBoardSceneId) :
-        mBuffer{},
-        mRandomEngine{RandomDevice()()},
+SolarSystem::SolarSystem(const SceneId leaderBoardSceneId, const helpers::Seed seed) :
+        mRandomEngine{helpers::deriveSeed(seed, Stream::SolarSystem)},
+        mSeed{seed},
         mLeaderBoardSceneId{leaderBoardSceneId} {}
 
-SolarSystem &SolarSystem::initialize(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept {
+SolarSystem &SolarSystem::initialize(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets) noexcept {
     initializePubSub();
-    initializeReport(assets);
-    initializePlayers(window, assets);
-    resetPlanets(window, sceneManager, assets);
+    initializeReport();
+    initializePlayers(viewport, assets);
+    resetPlanets(viewport, sceneManager, assets);
     return *this;
 }
 
-void SolarSystem::addPlanet(const sf::RenderWindow &window, sf::Color planetColor, SceneId planetSceneId) noexcept {
-    const auto[windowWidth, windowHeight] = window.getSize();
+void SolarSystem::addPlanet(const sf::FloatRect &viewport, sf::Color planetColor, SceneId planetSceneId) noexcept {
+    const auto windowWidth = viewport.width, windowHeight = viewport.height;
     const auto spawnPosition = sf::Vector2f(windowWidth, windowHeight) / 2.0f;
 
     auto planetRadiusDistribution = FloatDistribution(PLANET_MIN_RADIUS, PLANET_MAX_RADIUS);
     auto planetXDistribution = FloatDistribution(PLANET_MAX_RADIUS, windowWidth - PLANET_MAX_RADIUS);
     auto planetYDistribution = FloatDistribution(PLANET_MAX_RADIUS, windowHeight - PLANET_MAX_RADIUS);
 
-    auto circleShape = sf::CircleShape();
+    auto planetRadius = 0.0f;
+    auto planetPosition = sf::Vector2f();
     auto collides = true;
 
     for (auto i = 0u; collides and i < 128u; i++) {
         collides = false;
-        circleShape.setRadius(planetRadiusDistribution(mRandomEngine));
-        helpers::centerOrigin(circleShape, circleShape.getLocalBounds());
-        circleShape.setPosition(planetXDistribution(mRandomEngine), planetYDistribution(mRandomEngine));
+        planetRadius = planetRadiusDistribution(mRandomEngine);
+        planetPosition.x = planetXDistribution(mRandomEngine);
+        planetPosition.y = planetYDistribution(mRandomEngine);
 
         // if planet collides with spawn circle then retry
-        if (helpers::magnitude(spawnPosition, circleShape.getPosition()) <= SPAWN_RADIUS + circleShape.getRadius()) {
+        if (helpers::magnitude(spawnPosition, planetPosition) <= SPAWN_RADIUS + planetRadius) {
             collides = true;
             continue;
         }
@@ -92,7 +98,7 @@ void SolarSystem::addPlanet(const sf::RenderWindow &window, sf::Color planetColo
         for (const auto entityId : view) {
             const auto &[entityRenderable, entityHitRadius] = view.get<Renderable, HitRadius>(entityId);
 
-            if (helpers::magnitude(entityRenderable->getPosition(), circleShape.getPosition()) <= *entityHitRadius + circleShape.getRadius()) {
+            if (helpers::magnitude(entityRenderable.getPosition(), planetPosition) <= *entityHitRadius + planetRadius) {
                 collides = true;
                 break;
             }
@@ -104,51 +110,92 @@ void SolarSystem::addPlanet(const sf::RenderWindow &window, sf::Color planetColo
         std::terminate();
     } else {
         const auto planetId = mRegistry.create();
+        auto planetRenderable = Renderable::disc(planetRadius, planetColor);
 
-        circleShape.setFillColor(planetColor);
+        planetRenderable.setPosition(planetPosition);
         mRegistry.assign<Planet>(planetId);
         mRegistry.assign<SceneRef>(planetId, planetSceneId);
-        mRegistry.assign<HitRadius>(planetId, circleShape.getRadius());
-        mRegistry.assign<Renderable>(planetId, std::move(circleShape));
+        mRegistry.assign<HitRadius>(planetId, planetRadius);
+        mRegistry.assign<Renderable>(planetId, planetRenderable);
     }
 }
 
-SceneId SolarSystem::update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, const sf::Time elapsed) noexcept {
+SceneId SolarSystem::update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &, const Input &input, const sf::Time elapsed) noexcept {
     mNextSceneId = getSceneId();
 
     if (auto &audioManager = assets.getAudioManager(); SoundTrackId::ComputerF__k != audioManager.getPlaying()) {
         audioManager.play(SoundTrackId::ComputerF__k);
     }
 
-    inputSystem(elapsed);
-    motionSystem(elapsed);
-    collisionSystem(window);
-    livenessSystem(window, sceneManager, assets);
-    reportSystem(window);
+    allocations::scope("SolarSystem::inputSystem", [&]() { inputSystem(input, elapsed); });
+    allocations::scope("SolarSystem::motionSystem", [&]() { motionSystem(elapsed); });
+    allocations::scope("SolarSystem::collisionSystem", [&]() { collisionSystem(viewport, assets); });
+    allocations::scope("SolarSystem::livenessSystem", [&]() { livenessSystem(viewport, sceneManager, assets, frameArena); });
+    allocations::scope("SolarSystem::reportSystem", [&]() { reportSystem(viewport); });
 
     return mNextSceneId;
 }
 
-void SolarSystem::render(sf::RenderTarget &window) const noexcept {
-    window.draw(mReport);
+void SolarSystem::render(RenderSnapshot &snapshot) const noexcept {
+    snapshot.draw(mReport);
 
     mRegistry.view<const Renderable>().each([&](const auto id, const auto &renderable) {
         helpers::debug([&]() { // display hit-circle on debug builds only
             if (const auto hitRadius = mRegistry.try_get<HitRadius>(id); hitRadius) {
-                auto shape = sf::CircleShape(**hitRadius);
-                helpers::centerOrigin(shape, shape.getLocalBounds());
-                shape.setPosition(renderable->getPosition());
-                shape.setFillColor(sf::Color::Transparent);
-                shape.setOutlineColor(sf::Color::Red);
-                shape.setOutlineThickness(1);
-                window.draw(shape);
+                auto shape = Renderable::ring(**hitRadius, sf::Color::Red);
+                shape.setPosition(renderable.getPosition());
+                snapshot.draw(shape);
             }
         });
 
-        window.draw(renderable);
+        snapshot.draw(renderable);
     });
 }
 
+std::optional<Input> SolarSystem::autopilot(const sf::FloatRect &) const noexcept {
+    auto input = Input();
+    const auto players = mRegistry.view<const Player, const Renderable>();
+    const auto planets = mRegistry.view<const Planet, const Renderable>();
+
+    for (const auto playerId : players) {
+        const auto &playerRenderable = players.get<const Renderable>(playerId);
+        const auto playerPosition = playerRenderable.getPosition();
+        auto closestDistance = std::numeric_limits<float>::max();
+
+        for (const auto planetId : planets) { // head towards the closest planet
+            const auto planetPosition = planets.get<const Renderable>(planetId).getPosition();
+
+            if (const auto distance = helpers::magnitude(playerPosition, planetPosition); distance < closestDistance) {
+                closestDistance = distance;
+                input = Input();
+                autopilot::steer(input, playerRenderable.getRotation(), helpers::rotation(playerPosition, planetPosition));
+            }
+        }
+    }
+
+    return input;
+}
+
+void SolarSystem::save(OutputArchive &archive) const {
+    archive.write(mRegistry);
+    archive.write(mReport);
+    archive.write(mRandomEngine);
+    archive.write(mGeneratedPlanets);
+    archive.write(mNextSceneId);
+}
+
+void SolarSystem::load(InputArchive &archive) {
+    archive.read(mRegistry);
+    archive.read(mReport);
+    archive.read(mRandomEngine);
+    archive.read(mGeneratedPlanets);
+    archive.read(mNextSceneId);
+}
+
+void SolarSystem::hash(StateHash &hash) const noexcept {
+    hash.add(getSceneId(), mRegistry);
+}
+
 void SolarSystem::operator()(const SolarSystemEntered &message) noexcept {
     const auto planets = mRegistry.view<Planet, SceneRef>();
 
@@ -156,11 +203,11 @@ void SolarSystem::operator()(const SolarSystemEntered &message) noexcept {
         if (message.sceneId == *planets.get<SceneRef>(planetId)) {
             const auto players = mRegistry.view<Player>();
 
-            mRegistry.destroy(players.begin(), players.end());
+            // the player never leaves this registry, it's brought up to date with the state it had on the planet
             for (const auto sourcePlayerId : message.registry.view<Player>()) {
-                const auto playerId = mRegistry.create(sourcePlayerId, message.registry);
-                mRegistry.get<Renderable>(playerId)->setPosition(sf::Vector2f(message.window.getSize()) / 2.0f);
-                mRegistry.remove<EntityRef<Tractor>>(playerId);
+                const auto playerId = *players.begin();
+                migration::migrate(message.registry, sourcePlayerId, mRegistry, playerId, static_cast<PlayerComponents *>(nullptr));
+                mRegistry.get<Renderable>(playerId).setPosition(sf::Vector2f(message.viewport.width, message.viewport.height) / 2.0f);
             }
 
             if (const auto bunkers = message.registry.view<Bunker>(); bunkers.begin() == bunkers.end()) {
@@ -177,19 +224,18 @@ void SolarSystem::initializePubSub() const noexcept {
     pubsub::subscribe<messages::SolarSystemEntered>(*this);
 }
 
-void SolarSystem::initializeReport(Assets &assets) noexcept {
-    mReport.setCharacterSize(18);
-    mReport.setFillColor(sf::Color(105, 235, 245, 255));
-    mReport.setFont(assets.getFontsManager().get(FontId::Mechanical));
+void SolarSystem::initializeReport() noexcept {
+    mReport.characterSize = 18u;
+    mReport.color = sf::Color(105, 235, 245, 255);
+    mReport.fontId = FontId::Mechanical;
 }
 
-void SolarSystem::initializePlayers(const sf::RenderWindow &window, Assets &assets) noexcept {
+void SolarSystem::initializePlayers(const sf::FloatRect &viewport, Assets &assets) noexcept {
     auto playerId = mRegistry.create();
-    auto playerRenderable = assets.getSpriteSheetsManager().get(SpriteSheetId::SpaceShip).instanceSprite(0);
-    const auto playerBounds = playerRenderable.getLocalBounds();
+    auto playerRenderable = Renderable::sprite(SpriteSheetId::SpaceShip, 0);
+    const auto &playerFrame = assets.getSpriteSheetsManager().get(SpriteSheetId::SpaceShip).getBuffer().at(0);
 
-    helpers::centerOrigin(playerRenderable, playerBounds);
-    playerRenderable.setPosition(sf::Vector2f(window.getSize()) / 2.0f);
+    playerRenderable.setPosition(sf::Vector2f(viewport.width, viewport.height) / 2.0f);
     playerRenderable.setRotation(90.0f);
 
     mRegistry.assign<Player>(playerId);
@@ -199,32 +245,32 @@ void SolarSystem::initializePlayers(const sf::RenderWindow &window, Assets &asse
     mRegistry.assign<Energy>(playerId, PLAYER_ENERGY);
     mRegistry.assign<Velocity>(playerId);
     mRegistry.assign<ReloadTime>(playerId, PLAYER_RELOAD_TIME);
-    mRegistry.assign<HitRadius>(playerId, std::max(playerBounds.width, playerBounds.height) / 2.0f);
-    mRegistry.assign<Renderable>(playerId, std::move(playerRenderable));
+    mRegistry.assign<HitRadius>(playerId, std::max(playerFrame.width, playerFrame.height) / 2.0f);
+    mRegistry.assign<Renderable>(playerId, playerRenderable);
 }
 
-void SolarSystem::resetPlanets(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept {
-    const auto windowCenter = sf::Vector2f(window.getSize()) / 2.0f;
+void SolarSystem::resetPlanets(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets) noexcept {
+    const auto windowCenter = sf::Vector2f(viewport.width, viewport.height) / 2.0f;
     auto planetsColorsSelector = IntDistribution(0, PLANET_COLORS.size() - 1);
 
     mRegistry.view<Player, Renderable>().each([&](const auto, auto &renderable) {
-        renderable->setPosition(windowCenter);
+        renderable.setPosition(windowCenter);
     });
 
     for (auto i = 0u; i < PLANETS; i++) {
         const auto rgb = PLANET_COLORS[planetsColorsSelector(mRandomEngine)];
         const auto planetColor = sf::Color(rgb[0], rgb[1], rgb[2]);
         auto &planetAssault = sceneManager
-                .emplace<PlanetAssault>(getSceneId(), mLeaderBoardSceneId)
-                .initialize(window, assets, planetColor);
+                .emplace<PlanetAssault>(getSceneId(), mLeaderBoardSceneId, helpers::deriveSeed(mSeed, Stream::Planet, mGeneratedPlanets++))
+                .initialize(viewport, assets, planetColor);
 
-        addPlanet(window, planetColor, planetAssault.getSceneId());
+        addPlanet(viewport, planetColor, planetAssault.getSceneId());
     }
 }
 
-void SolarSystem::inputSystem(const sf::Time elapsed) noexcept {
+void SolarSystem::inputSystem(const Input &input, const sf::Time elapsed) noexcept {
     using Key = sf::Keyboard::Key;
-    const auto isKeyPressed = &sf::Keyboard::isKeyPressed;
+    const auto isKeyPressed = [&input](const Key key) { return input.isKeyPressed(key); };
 
     mRegistry
             .view<Player, Energy, Velocity, Renderable>()
@@ -238,45 +284,57 @@ void SolarSystem::inputSystem(const sf::Time elapsed) noexcept {
                 }
 
                 if (isKeyPressed(Key::A)) {
-                    playerRenderable->rotate(-PLAYER_ROTATION_SPEED * elapsed.asSeconds());
+                    playerRenderable.rotate(-PLAYER_ROTATION_SPEED * elapsed.asSeconds());
                 }
 
                 if (isKeyPressed(Key::D)) {
-                    playerRenderable->rotate(PLAYER_ROTATION_SPEED * elapsed.asSeconds());
+                    playerRenderable.rotate(PLAYER_ROTATION_SPEED * elapsed.asSeconds());
                 }
 
-                playerVelocity.value = helpers::makeVector2(playerRenderable->getRotation(), speed);
+                playerVelocity.value = helpers::makeVector2(playerRenderable.getRotation(), speed);
                 playerEnergy.consume(speed * elapsed.asSeconds());
             });
 }
 
 void SolarSystem::motionSystem(const sf::Time elapsed) noexcept {
     mRegistry.view<Velocity, Renderable>().each([&](const auto &velocity, auto &renderable) {
-        renderable->move(velocity.value * elapsed.asSeconds());
+        renderable.move(velocity.value * elapsed.asSeconds());
     });
 }
 
-void SolarSystem::collisionSystem(const sf::RenderWindow &window) noexcept {
-    const auto viewport = sf::FloatRect(window.getViewport(window.getView()));
+void SolarSystem::collisionSystem(const sf::FloatRect &viewport, Assets &assets) noexcept {
     const auto players = mRegistry.view<Player, HitRadius, Renderable>();
 
     for (const auto playerId : players) {
         const auto &[playerHitRadius, playerRenderable] = players.get<HitRadius, Renderable>(playerId);
 
-        if (viewport.contains(playerRenderable->getPosition())) {
+        if (viewport.contains(playerRenderable.getPosition())) {
             const auto planets = mRegistry.view<Planet, Renderable, HitRadius, SceneRef>();
 
             for (const auto planetId : planets) {
                 const auto &[planetHitRadius, planetRenderable, planetSceneRef] = planets.get<HitRadius, Renderable, SceneRef>(planetId);
 
-                if (helpers::magnitude(playerRenderable->getPosition(), planetRenderable->getPosition()) <= *playerHitRadius + *planetHitRadius) {
+                const auto distance = helpers::magnitude(playerRenderable.getPosition(), planetRenderable.getPosition());
+
+                if (distance <= *playerHitRadius + *planetHitRadius) {
                     mNextSceneId = *planetSceneRef;
-                    pubsub::publish<PlanetEntered>(window, mRegistry, *planetSceneRef);
+                    pubsub::publish<PlanetEntered>(viewport, assets, mRegistry, *planetSceneRef);
                     return; // we can enter only one planet at a time
                 }
+
+                // the planet generates its terrain in background while the player is on its way, if ever: it's told
+                // once, when the ship gets within range
+                const auto isInRange = distance <= *playerHitRadius + *planetHitRadius + PLANET_PREFETCH_DISTANCE;
+
+                if (isInRange and not mRegistry.has<Approached>(planetId)) {
+                    mRegistry.assign<Approached>(planetId);
+                    pubsub::publish<PlanetApproached>(viewport, assets, *planetSceneRef);
+                } else if (not isInRange and mRegistry.has<Approached>(planetId)) {
+                    mRegistry.remove<Approached>(planetId);
+                }
             }
         } else {
-            auto[playerX, playerY] = playerRenderable->getPosition();
+            auto[playerX, playerY] = playerRenderable.getPosition();
 
             if (playerX <= 0) {
                 playerX = viewport.width - *playerHitRadius;
@@ -290,13 +348,13 @@ void SolarSystem::collisionSystem(const sf::RenderWindow &window) noexcept {
                 playerY = *playerHitRadius;
             }
 
-            playerRenderable->setPosition(playerX, playerY);
+            playerRenderable.setPosition(playerX, playerY);
         }
     }
 }
 
-void SolarSystem::livenessSystem(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept {
-    auto entitiesToDestroy = std::vector<entt::entity>();
+void SolarSystem::livenessSystem(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena) noexcept {
+    auto entitiesToDestroy = std::pmr::vector<entt::entity>(&frameArena);
 
     const auto players = mRegistry.view<Player, Health, Energy>();
     for (const auto id : players) {
@@ -312,22 +370,19 @@ void SolarSystem::livenessSystem(const sf::RenderWindow &window, SceneManager &s
 
     if (mRegistry.view<Planet>().begin() == mRegistry.view<Planet>().end()) { // no more planets left
         mRegistry.view<Player, Score>().each([](const auto, auto &score) { score.value += SCORE_PER_SOLAR_SYSTEM; });
-        resetPlanets(window, sceneManager, assets);
+        resetPlanets(viewport, sceneManager, assets);
     }
 
     mRegistry.destroy(entitiesToDestroy.begin(), entitiesToDestroy.end());
 }
 
-void SolarSystem::reportSystem(const sf::RenderWindow &window) noexcept {
+void SolarSystem::reportSystem(const sf::FloatRect &viewport) noexcept {
     mRegistry.view<Player, Health, Energy, Score>().each([&](const auto, const auto &health, const auto &energy, const auto &score) {
         std::snprintf(
-                mBuffer, std::size(mBuffer),
+                mReport.string.data(), mReport.string.size(),
                 "health: %02d energy: %05.0f score: %05u",
                 health.getValue(), energy.getValue(), score.value
         );
-        helpers::centerOrigin(mReport, mReport.getLocalBounds());
-
-        mReport.setString(mBuffer);
-        mReport.setPosition(window.getSize().x / 2.0f, 18.0f);
+        mReport.position = sf::Vector2f(viewport.width / 2.0f, 18.0f);
     });
 }
@@ -32,15 +32,22 @@
 #include <pubsub.hpp>
 #include <helpers.hpp>
 #include <messages.hpp>
+#include <RenderSnapshot.hpp>
 #include <SceneManager.hpp>
 
+namespace nongravitar::bench {
+    class Probe;
+}
+
 namespace nongravitar::scene {
     class SolarSystem final : public Scene,
                               public pubsub::Handler<messages::SolarSystemEntered> {
+        friend class bench::Probe;
+
     public:
         SolarSystem() = delete; // no default-constructible
 
-        explicit SolarSystem(SceneId leaderBoardSceneId);
+        SolarSystem(SceneId leaderBoardSceneId, helpers::Seed seed);
 
         SolarSystem(const SolarSystem &) = delete; // no copy-constructible
         SolarSystem &operator=(const SolarSystem &) = delete; // no copy-assignable
@@ -53,32 +60,46 @@ namespace nongravitar::scene {
          *  This method should be called exactly once in the life-cycle of this object, any usage of this object
          *  without proper initialization will result in a error.
          */
-        SolarSystem &initialize(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept;
+        SolarSystem &initialize(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets) noexcept;
+
+        SceneId update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept final;
+
+        void render(RenderSnapshot &snapshot) const noexcept final;
 
-        SceneId update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept final;
+        [[nodiscard]] std::optional<Input> autopilot(const sf::FloatRect &viewport) const noexcept final;
 
-        void render(sf::RenderTarget &window) const noexcept final;
+        void save(OutputArchive &archive) const final;
+
+        void load(InputArchive &archive) final;
+
+        void hash(StateHash &hash) const noexcept final;
+
+        /**
+         * Generate a new batch of planets, each one with its own scene appended to the scene manager.
+         * Planet scenes are the only ones created after initialization, this is how they get re-created on restore.
+         */
+        void resetPlanets(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets) noexcept;
 
     private:
         void operator()(const messages::SolarSystemEntered &message) noexcept final;
 
         void initializePubSub() const noexcept;
-        void initializeReport(Assets &assets) noexcept;
-        void initializePlayers(const sf::RenderWindow &window, Assets &assets) noexcept;
-        void resetPlanets(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept;
+        void initializeReport() noexcept;
+        void initializePlayers(const sf::FloatRect &viewport, Assets &assets) noexcept;
 
-        void addPlanet(const sf::RenderWindow &window, sf::Color planetColor, SceneId planetSceneId) noexcept;
+        void addPlanet(const sf::FloatRect &viewport, sf::Color planetColor, SceneId planetSceneId) noexcept;
 
-        void inputSystem(sf::Time elapsed) noexcept;
+        void inputSystem(const Input &input, sf::Time elapsed) noexcept;
         void motionSystem(sf::Time elapsed) noexcept;
-        void collisionSystem(const sf::RenderWindow &window) noexcept;
-        void livenessSystem(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets) noexcept;
-        void reportSystem(const sf::RenderWindow &window) noexcept;
+        void collisionSystem(const sf::FloatRect &viewport, Assets &assets) noexcept;
+        void livenessSystem(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena) noexcept;
+        void reportSystem(const sf::FloatRect &viewport) noexcept;
 
         entt::registry mRegistry;
-        char mBuffer[56];
-        sf::Text mReport;
+        Label mReport;
         helpers::RandomEngine mRandomEngine;
+        const helpers::Seed mSeed;
+        std::uint64_t mGeneratedPlanets{0u};
         const SceneId mLeaderBoardSceneId;
         SceneId mNextSceneId = nullSceneId;
     };
@@ -25,7 +25,9 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <cstring>
 #include <helpers.hpp>
+#include <RenderSnapshot.hpp>
 #include <scene/TitleScreen.hpp>
 
 using namespace nongravitar;
@@ -38,20 +40,20 @@ constexpr auto BOTTOM_PADDING = 32.0f;
 
 TitleScreen::TitleScreen(const SceneId solarSystemSceneId, Assets &assets) :
         mTitle(assets.getTexturesManager().get(TextureId::Title)),
-        mSpaceLabel("[SPACE]", assets.getFontsManager().get(FontId::Mechanical), 32.0f),
+        mSpaceLabelHeight(sf::Text("[SPACE]", assets.getFontsManager().get(FontId::Mechanical), 32u).getLocalBounds().height),
         mSolarSystemSceneId{solarSystemSceneId} {
     helpers::centerOrigin(mTitle, mTitle.getLocalBounds());
-    helpers::centerOrigin(mSpaceLabel, mSpaceLabel.getLocalBounds());
+    std::strncpy(mSpaceLabel.string.data(), "[SPACE]", mSpaceLabel.string.size() - 1);
+    mSpaceLabel.characterSize = 32u;
 }
 
 SceneId TitleScreen::onEvent(const sf::Event &event) noexcept {
     return (sf::Event::KeyPressed == event.type and sf::Keyboard::Space == event.key.code) ? mSolarSystemSceneId : getSceneId();
 }
 
-SceneId TitleScreen::update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept {
-    const auto[windowWidth, windowHeight] = window.getSize();
-    const auto spaceLabelHeight = mSpaceLabel.getLocalBounds().height;
-    const auto scaleFactor = (windowHeight - TOP_PADDING - MIDDLE_PADDING - spaceLabelHeight - BOTTOM_PADDING) / mTitle.getLocalBounds().height;
+SceneId TitleScreen::update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept {
+    const auto windowWidth = viewport.width, windowHeight = viewport.height;
+    const auto scaleFactor = (windowHeight - TOP_PADDING - MIDDLE_PADDING - mSpaceLabelHeight - BOTTOM_PADDING) / mTitle.getLocalBounds().height;
 
     if (auto &audioManager = assets.getAudioManager(); SoundTrackId::AmbientStarfield != audioManager.getPlaying()) {
         audioManager.play(SoundTrackId::AmbientStarfield);
@@ -59,12 +61,18 @@ SceneId TitleScreen::update(const sf::RenderWindow &window, SceneManager &sceneM
 
     mTitle.setScale(scaleFactor, scaleFactor);
     mTitle.setPosition(windowWidth / 2.0f, TOP_PADDING + mTitle.getGlobalBounds().height / 2.0f);
-    mSpaceLabel.setPosition(windowWidth / 2.0f, TOP_PADDING + mTitle.getGlobalBounds().height + MIDDLE_PADDING + spaceLabelHeight / 2.0f);
+    mSpaceLabel.position = sf::Vector2f(windowWidth / 2.0f, TOP_PADDING + mTitle.getGlobalBounds().height + MIDDLE_PADDING + mSpaceLabelHeight / 2.0f);
 
-    return Scene::update(window, sceneManager, assets, elapsed);
+    return Scene::update(viewport, sceneManager, assets, frameArena, workerPool, input, elapsed);
 }
 
-void TitleScreen::render(sf::RenderTarget &window) const noexcept {
-    window.draw(mTitle);
-    window.draw(mSpaceLabel);
+void TitleScreen::render(RenderSnapshot &snapshot) const noexcept {
+    snapshot.draw(mTitle);
+    snapshot.draw(mSpaceLabel);
+}
+
+std::optional<Input> TitleScreen::autopilot(const sf::FloatRect &) const noexcept {
+    auto input = Input();
+    input.press(sf::Keyboard::Space);
+    return input;
 }
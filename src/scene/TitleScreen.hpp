@@ -28,6 +28,7 @@
 #pragma once
 
 #include <Scene.hpp>
+#include <RenderSnapshot.hpp>
 
 namespace nongravitar::scene {
     class TitleScreen final : public Scene {
@@ -44,13 +45,16 @@ namespace nongravitar::scene {
 
         SceneId onEvent(const sf::Event &event) noexcept final;
 
-        SceneId update(const sf::RenderWindow &window, SceneManager &sceneManager, Assets &assets, sf::Time elapsed) noexcept final;
+        SceneId update(const sf::FloatRect &viewport, SceneManager &sceneManager, Assets &assets, FrameArena &frameArena, WorkerPool &workerPool, const Input &input, sf::Time elapsed) noexcept final;
 
-        void render(sf::RenderTarget &window) const noexcept final;
+        void render(RenderSnapshot &snapshot) const noexcept final;
+
+        [[nodiscard]] std::optional<Input> autopilot(const sf::FloatRect &viewport) const noexcept final;
 
     private:
         sf::Sprite mTitle;
-        sf::Text mSpaceLabel;
+        Label mSpaceLabel;
+        const float mSpaceLabelHeight;
         const SceneId mSolarSystemSceneId;
     };
 }
@@ -32,8 +32,10 @@
 namespace nongravitar::tags {
     using AI1 = entt::tag<"AI1"_hs>;
     using AI2 = entt::tag<"AI2"_hs>;
+    using Approached = entt::tag<"Approached"_hs>; // a planet the ship is within prefetch distance of
     using Bullet = entt::tag<"Bullet"_hs>;
     using Bunker = entt::tag<"Bunker"_hs>;
+    using Dirty = entt::tag<"Dirty"_hs>; // health or energy changed during the current tick
     using Hidden = entt::tag<"Hidden"_hs>;
     using Player = entt::tag<"Player"_hs>;
     using Planet = entt::tag<"Planet"_hs>;
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2019 Davide Di Carlo
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation
+# files (the "Software"), to deal in the Software without
+# restriction, including without limitation the rights to use,
+# copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following
+# conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+# OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+# HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+"""
+Compare the performance of two builds, e.g. the one of a branch against the one of master.
+
+Each run executes the benchmark suites (and optionally plays replays back headless) once per build, alternating the
+builds so that any drift of the machine hits both of them alike. Every measure ends up with one value per run per
+build, the two distributions are then compared by their medians, a 95% confidence interval of each median and a
+two-sided Mann-Whitney U test.
+
+A measure regresses when the candidate median is slower by more than --threshold percent and the test is significant.
+
+Exit status: 0 if nothing regressed, 1 if something did, 2 on errors.
+
+Example:
+    tools/benchcompare.py --baseline build-master --candidate build-branch --runs 7 --suite systems --replay run.ngr
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+FAST_FORWARD = re.compile(r"fast-forward: \d+ ticks in [0-9.e+-]+s \((\d+) ticks/s\)")
+
+
+def run_suite(build, suite, extra):
+    """Values (median ns) of every measure of a benchmark suite, keyed by suite/name/entities."""
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "results.json")
+        command = [os.path.join(build, "nongravitar-bench"), suite, "--json", path] + extra
+        process = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, universal_newlines=True)
+
+        # the soak exits with 1 when it fails its guarantees, its timings are still worth comparing
+        if process.returncode not in (0, 1) or not os.path.exists(path):
+            raise RuntimeError("{} failed:\n{}".format(" ".join(command), process.stderr))
+
+        with open(path) as stream:
+            results = json.load(stream)["results"]
+
+    return {"{}/{}/{}".format(suite, result["name"], result["entities"]): float(result["median_ns"]) for result in results}
+
+
+def run_replay(build, replay):
+    """Nanoseconds per tick of a replay played back headless, keyed by replay/file name."""
+    command = [os.path.join(build, "nongravitar"), "--replay", replay, "--headless"]
+    process = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, universal_newlines=True)
+    match = FAST_FORWARD.search(process.stderr)
+
+    if process.returncode != 0 or not match or int(match.group(1)) == 0:
+        raise RuntimeError("{} failed:\n{}".format(" ".join(command), process.stderr))
+
+    return {"replay/{}".format(os.path.basename(replay)): 1e9 / int(match.group(1))}
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    return ordered[middle] if len(ordered) % 2 else (ordered[middle - 1] + ordered[middle]) / 2.0
+
+
+def median_interval(values, confidence=0.95):
+    """Distribution-free confidence interval of the median from the order statistics, the widest one for few values."""
+    ordered = sorted(values)
+    n = len(ordered)
+    # smallest k such that P(X < k) >= (1 - confidence) / 2 with X ~ Binomial(n, 1/2)
+    cumulative, lower = 0.0, 0
+    for k in range(n + 1):
+        cumulative += math.comb(n, k) / 2.0 ** n
+        if cumulative > (1.0 - confidence) / 2.0:
+            lower = max(k - 1, 0)
+            break
+    return ordered[lower], ordered[n - 1 - lower]
+
+
+def mann_whitney(left, right):
+    """Two-sided p-value of the Mann-Whitney U test: exact for small samples without ties, normal otherwise."""
+    m, n = len(left), len(right)
+    pooled = sorted([(value, 0) for value in left] + [(value, 1) for value in right])
+    ranks = [0.0] * len(pooled)
+    ties = []
+
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        if j > i:
+            ties.append(j - i + 1)
+        i = j + 1
+
+    u = sum(rank for rank, (_, group) in zip(ranks, pooled) if group == 0) - m * (m + 1) / 2.0
+    u = min(u, m * n - u)
+
+    if not ties and m <= 10 and n <= 10:
+        # counts[k] = arrangements with U == k, built one value at a time
+        counts = {(0, 0): [1]}
+
+        def arrangements(a, b):
+            if (a, b) not in counts:
+                size = a * b + 1
+                result = [0] * size
+                if a > 0:
+                    for k, c in enumerate(arrangements(a - 1, b)):
+                        result[k + b] += c
+                if b > 0:
+                    for k, c in enumerate(arrangements(a, b - 1)):
+                        result[k] += c
+                counts[(a, b)] = result
+            return counts[(a, b)]
+
+        distribution = arrangements(m, n)
+        total = sum(distribution)
+        return min(1.0, 2.0 * sum(distribution[:int(u) + 1]) / total)
+
+    mean = m * n / 2.0
+    correction = sum(t ** 3 - t for t in ties) / ((m + n) * (m + n - 1)) if m + n > 1 else 0.0
+    deviation = math.sqrt(m * n / 12.0 * ((m + n + 1) - correction))
+    if deviation == 0.0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / deviation
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2.0)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--baseline", required=True, help="build directory of the reference build")
+    parser.add_argument("--candidate", required=True, help="build directory of the build under test")
+    parser.add_argument("--runs", type=int, default=5, help="runs per build (default: 5)")
+    parser.add_argument("--suite", action="append", help="benchmark suite to run, repeatable (default: systems)")
+    parser.add_argument("--bench-args", default="", help="extra arguments of nongravitar-bench, e.g. '--samples 8'")
+    parser.add_argument("--replay", action="append", default=[], help="replay to play back headless, repeatable")
+    parser.add_argument("--threshold", type=float, default=5.0, help="slowdown in percent to be a regression (default: 5)")
+    parser.add_argument("--alpha", type=float, default=0.05, help="significance level of the test (default: 0.05)")
+    arguments = parser.parse_args()
+
+    suites = arguments.suite or ["systems"]
+    extra = shlex.split(arguments.bench_args)
+    builds = {"baseline": arguments.baseline, "candidate": arguments.candidate}
+    values = {build: {} for build in builds}
+
+    try:
+        for run in range(arguments.runs):
+            for build, directory in builds.items():
+                print("run {}/{}: {}".format(run + 1, arguments.runs, build), file=sys.stderr)
+                measures = {}
+                for suite in suites:
+                    measures.update(run_suite(directory, suite, extra))
+                for replay in arguments.replay:
+                    measures.update(run_replay(directory, replay))
+                for key, value in measures.items():
+                    values[build].setdefault(key, []).append(value)
+    except (OSError, RuntimeError) as error:
+        print(error, file=sys.stderr)
+        return 2
+
+    header = "{:<48} {:>22} {:>22} {:>9} {:>8}  {}".format("measure", "baseline (ns)", "candidate (ns)", "change", "p", "verdict")
+    print(header)
+    print("-" * len(header))
+
+    regressions = 0
+    for key in sorted(set(values["baseline"]) & set(values["candidate"])):
+        baseline, candidate = values["baseline"][key], values["candidate"][key]
+        baseline_median, candidate_median = median(baseline), median(candidate)
+        baseline_low, baseline_high = median_interval(baseline)
+        candidate_low, candidate_high = median_interval(candidate)
+        change = 0.0 if baseline_median == 0.0 else 100.0 * (candidate_median - baseline_median) / baseline_median
+        p = mann_whitney(baseline, candidate)
+
+        if p < arguments.alpha and change > arguments.threshold:
+            verdict, regressions = "FAIL", regressions + 1
+        elif p < arguments.alpha and change < -arguments.threshold:
+            verdict = "faster"
+        else:
+            verdict = "pass"
+
+        print("{:<48} {:>22} {:>22} {:>+8.1f}% {:>8.3f}  {}".format(
+            key,
+            "{:.0f} [{:.0f}, {:.0f}]".format(baseline_median, baseline_low, baseline_high),
+            "{:.0f} [{:.0f}, {:.0f}]".format(candidate_median, candidate_low, candidate_high),
+            change, p, verdict))
+
+    print("{} regression(s) over a {}% threshold at alpha {}".format(regressions, arguments.threshold, arguments.alpha))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,149 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Davide Di Carlo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Compare two state hash logs written by `nongravitar --hashes <file>`, reporting the first tick at which they
+ * diverge and the components that diverged.
+ *
+ * Exit status: 0 if the logs agree on every tick they have in common, 1 if they diverge, 2 on errors.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+struct Log final {
+    std::vector<std::string> columns;
+    std::ifstream stream;
+};
+
+struct Line final {
+    std::uint64_t tick{0u};
+    std::vector<std::string> hashes;
+};
+
+bool open(Log &log, const char *path);
+bool next(Log &log, Line &line);
+
+int main(const int argc, const char *const argv[]) {
+    if (3 != argc) {
+        std::cerr << "Usage: hashdiff <left> <right>" << std::endl;
+        return 2;
+    }
+
+    auto left = Log(), right = Log();
+    if (not open(left, argv[1]) or not open(right, argv[2])) {
+        return 2;
+    }
+
+    if (left.columns != right.columns) {
+        std::cerr << "The logs hash different components" << std::endl;
+        return 2;
+    }
+
+    auto leftLine = Line(), rightLine = Line();
+    auto hasLeft = next(left, leftLine), hasRight = next(right, rightLine);
+    auto compared = std::uint64_t{0u};
+
+    // logs of sought replays start later on, only the ticks in common are compared
+    while (hasLeft and hasRight) {
+        if (leftLine.tick < rightLine.tick) {
+            hasLeft = next(left, leftLine);
+        } else if (rightLine.tick < leftLine.tick) {
+            hasRight = next(right, rightLine);
+        } else {
+            if (leftLine.hashes != rightLine.hashes) {
+                std::cout << "diverged at tick " << leftLine.tick << ":";
+                for (auto i = 0u; i < leftLine.hashes.size(); i++) {
+                    if (leftLine.hashes[i] != rightLine.hashes[i]) {
+                        std::cout << ' ' << left.columns[i + 1];
+                    }
+                }
+                std::cout << std::endl;
+                return 1;
+            }
+
+            compared += 1;
+            hasLeft = next(left, leftLine);
+            hasRight = next(right, rightLine);
+        }
+    }
+
+    std::cout << "identical over " << compared << " ticks";
+    if (hasLeft or hasRight) {
+        std::cout << ", " << (hasLeft ? argv[1] : argv[2]) << " goes on";
+    }
+    std::cout << std::endl;
+    return 0;
+}
+
+bool open(Log &log, const char *const path) {
+    log.stream.open(path);
+
+    auto header = std::string();
+    if (not log.stream or not std::getline(log.stream, header)) {
+        std::cerr << "Unable to read: " << path << std::endl;
+        return false;
+    }
+
+    auto columns = std::istringstream(header);
+    for (auto column = std::string(); columns >> column;) {
+        log.columns.push_back(column);
+    }
+
+    if (log.columns.size() < 2 or "tick" != log.columns.front()) {
+        std::cerr << "Not a hash log: " << path << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool next(Log &log, Line &line) {
+    auto text = std::string();
+    if (not std::getline(log.stream, text)) {
+        return false;
+    }
+
+    auto fields = std::istringstream(text);
+    line.hashes.assign(log.columns.size() - 1, std::string());
+
+    if (not(fields >> line.tick)) {
+        return false;
+    }
+
+    for (auto &hash : line.hashes) {
+        if (not(fields >> hash)) {
+            return false; // a truncated line ends the log
+        }
+    }
+
+    return true;
+}